@@ -9,6 +9,7 @@
 #include <map>
 #include <unordered_map>
 #include <random>
+#include <memory>
 
 auto length(const std::string &s) { return s.length(); }
 auto length(int) { return 1; }
@@ -308,4 +309,3 @@ TEST_CASE("Robin Hood - insertions", "[robin-hood]") {
     randomInsertionCore<50000, um>(g, "50000 - std", 60000);
     randomInsertionCore<50000, RHT<60000, 6, 2>>(g, "50000 - 6/2");
 }
-
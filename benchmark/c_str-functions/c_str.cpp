@@ -2,9 +2,11 @@
 #include "c_str-impl.h"
 
 #include "zoo/swar/associative_iteration.h"
+#include "zoo/swar/VectorRegister.h"
 #include "zoo/root/mem.h"
+#include "zoo/root/cpu.h"
 
-#if ZOO_CONFIGURED_TO_USE_AVX()
+#if ZOO_CONFIGURED_TO_USE_AVX() || ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
 #include <immintrin.h>
 #endif
 
@@ -292,6 +294,32 @@ int64_t c_strToL128(const char *str) noexcept {
     return impl::c_strToIntegral<int64_t, calculateBase10_128>(str);
 }
 
+#if ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+/// The same code, the 128 bit arithmetic benefits from the BMI2 shifts and
+/// multiplication
+ZOO_TARGET("bmi2")
+int64_t c_strToL128_BMI2(const char *str) noexcept {
+    return impl::c_strToIntegral<int64_t, calculateBase10_128>(str);
+}
+#endif
+
+namespace {
+
+struct C_StrToL_Resolver {
+    static auto resolve([[maybe_unused]] const CPUFeatures &features) noexcept {
+        #if ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+            if(features.bmi2) { return c_strToL128_BMI2; }
+        #endif
+        return c_strToL128;
+    }
+};
+
+}
+
+int64_t c_strToL_dispatched(const char *str) noexcept {
+    return Dispatched<C_StrToL_Resolver, int64_t(const char *)>::call(str);
+}
+
 
 /// \brief Helper function to fix the non-string part of block
 template<typename S>
@@ -308,12 +336,15 @@ S adjustMisalignmentFor_strlen(S data, int misalignment) {
     return data | S{onesInMisalignedZeroesInValid};
 }
 
-std::size_t c_strLength(const char *s) {
-    using S = swar::SWAR<8, uint64_t>;
+/// \tparam T the type of the block read per iteration, \c uint64_t or a
+/// \c swar::VectorRegister
+template<typename T>
+std::size_t c_strLength_impl(const char *s) {
+    using S = swar::SWAR<8, T>;
     constexpr auto
         MSBs = S{S::MostSignificantBit},
         Ones = S{S::LeastSignificantBit};
-    constexpr auto BytesPerIteration = sizeof(S::type);
+    constexpr auto BytesPerIteration = sizeof(typename S::type);
     S initialBytes;
 
     auto indexOfFirstTrue = [](auto bs) { return bs.lsbIndex(); };
@@ -349,6 +380,16 @@ std::size_t c_strLength(const char *s) {
     }
 }
 
+std::size_t c_strLength(const char *s) {
+    return c_strLength_impl<uint64_t>(s);
+}
+
+#ifndef _MSC_VER
+std::size_t c_strLength_wide(const char *s) {
+    return c_strLength_impl<swar::VectorRegister<256>>(s);
+}
+#endif
+
 std::size_t c_strLength_natural(const char *s) {
     using S = swar::SWAR<8, std::uint64_t>;
     S initialBytes;
@@ -387,14 +428,36 @@ std::size_t c_strLength_manualComparison(const char *s) {
     }
 }
 
-#if ZOO_CONFIGURED_TO_USE_AVX()
+#if ZOO_CONFIGURED_TO_USE_AVX() || ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+
+namespace {
+
+/// Without the compilation options for the extension, the vector types are
+/// not aligned to their size
+template<int Size>
+struct alignas(Size) AlignedBytes { char bytes[Size]; };
+
+/// \note a lambda would not be compiled for the target of its enclosing
+/// function
+ZOO_TARGET("avx2")
+int nullMask_AVX2(__m256i data) {
+    const __m256i zero = _mm256_setzero_si256(); // Vector of 32 zero bytes
+    // Compare each byte with '\0'
+    __m256i cmp = _mm256_cmpeq_epi8(data, zero);
+    // Create a mask indicating which bytes are '\0'
+    return _mm256_movemask_epi8(cmp);
+}
+
+}
 
 /// \note Partially generated by Chat GPT 4
+ZOO_TARGET("avx2")
 size_t avx2_strlen(const char* str) {
-    const __m256i zero = _mm256_setzero_si256(); // Vector of 32 zero bytes
     size_t offset = 0;
     __m256i data;
-    auto [alignedBase, misalignment] = blockAlignedLoad(str, &data);
+    AlignedBytes<32> block;
+    auto [alignedBase, misalignment] = blockAlignedLoad(str, &block);
+    memcpy(&data, &block, 32);
 
     // AVX does not offer a practical way to generate a mask of all ones in
     // the least significant positions, thus we cant invoke adjustFor_strlen.
@@ -402,14 +465,7 @@ size_t avx2_strlen(const char* str) {
     // account misalignment
     auto maskOfMask = (~uint64_t(0)) << misalignment;
 
-    auto compareAndMask =
-        [&]() {
-            // Compare each byte with '\0'
-            __m256i cmp = _mm256_cmpeq_epi8(data, zero);
-            // Create a mask indicating which bytes are '\0'
-            return _mm256_movemask_epi8(cmp);
-        };
-    auto mask = compareAndMask();
+    auto mask = nullMask_AVX2(data);
     mask &= maskOfMask;
 
     // Loop over the string in blocks of 32 bytes
@@ -422,13 +478,53 @@ size_t avx2_strlen(const char* str) {
         }
         offset += 32;
         memcpy(&data, alignedBase + offset, 32);
-        mask = compareAndMask();
+        mask = nullMask_AVX2(data);
     }
     // Unreachable, but included to avoid compiler warnings
     return offset;
 }
 #endif
 
+#if ZOO_CONFIGURED_TO_USE_AVX512() || ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+/// As \c avx2_strlen, the comparison results directly in a bit mask
+ZOO_TARGET("avx512f,avx512bw")
+size_t avx512_strlen(const char* str) {
+    __m512i data;
+    AlignedBytes<64> block;
+    auto [alignedBase, misalignment] = blockAlignedLoad(str, &block);
+    memcpy(&data, &block, 64);
+    // the lanes with bytes equal to zero
+    uint64_t nulls = _mm512_testn_epi8_mask(data, data);
+    nulls &= (~uint64_t(0)) << misalignment;
+    for(;;) {
+        if(nulls) { return alignedBase + __builtin_ctzll(nulls) - str; }
+        alignedBase += 64;
+        memcpy(&data, alignedBase, 64);
+        nulls = _mm512_testn_epi8_mask(data, data);
+    }
+}
+#endif
+
+namespace {
+
+struct StrlenResolver {
+    using Pointer = std::size_t (*)(const char *);
+
+    static Pointer resolve([[maybe_unused]] const CPUFeatures &features) noexcept {
+        #if ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+            if(features.avx512bw) { return avx512_strlen; }
+            if(features.avx2) { return avx2_strlen; }
+        #endif
+        return c_strLength;
+    }
+};
+
+}
+
+std::size_t c_strLength_dispatched(const char *s) {
+    return Dispatched<StrlenResolver, std::size_t(const char *)>::call(s);
+}
+
 }
 
 /// \brief This is the last non-platform specific "generic" strlen in GLibC.
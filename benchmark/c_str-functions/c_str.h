@@ -18,6 +18,8 @@ std::size_t leadingSpacesCount(const char *) noexcept;
 
 std::size_t c_strLength(const char *s);
 std::size_t c_strLength_natural(const char *s);
+/// \brief \c c_strLength with 256 bit vector registers
+std::size_t c_strLength_wide(const char *s);
 
 int32_t c_strToI(const char *) noexcept;
 int64_t c_strToL(const char *) noexcept;
@@ -37,10 +39,20 @@ inline int64_t compareAtol(const char *s) {
     return from_stdlib;
 }
 
-#if ZOO_CONFIGURED_TO_USE_AVX()
+#if ZOO_CONFIGURED_TO_USE_AVX() || ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
 std::size_t avx2_strlen(const char* str);
 #endif
 
+#if ZOO_CONFIGURED_TO_USE_AVX512() || ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+std::size_t avx512_strlen(const char* str);
+#endif
+
+/// \brief The fastest of the \c strlen implementations above the processor
+/// supports, selected at run time
+std::size_t c_strLength_dispatched(const char *s);
+/// \brief \c c_strToL128 compiled for BMI2 if the processor supports it
+int64_t c_strToL_dispatched(const char *) noexcept;
+
 #if ZOO_CONFIGURED_TO_USE_NEON()
 std::size_t neon_strlen(const char* str);
 #endif
@@ -138,6 +138,13 @@ struct CorpusStringLength {
 #define AVX2_STRLEN_CORPUS_X_LIST /* nothing */
 #endif
 
+#if ZOO_CONFIGURED_TO_USE_AVX512()
+#define AVX512_STRLEN_CORPUS_X_LIST \
+    X(ZOO_AVX512, zoo::avx512_strlen)
+#else
+#define AVX512_STRLEN_CORPUS_X_LIST /* nothing */
+#endif
+
 #if ZOO_CONFIGURED_TO_USE_NEON()
 #define NEON_STRLEN_CORPUS_X_LIST \
     X(ZOO_NEON, zoo::neon_strlen)
@@ -146,12 +153,22 @@ struct CorpusStringLength {
 #endif
 
 
+#ifndef _MSC_VER
+#define WIDE_STRLEN_CORPUS_X_LIST \
+    X(ZOO_WIDE_STRLEN, zoo::c_strLength_wide)
+#else
+#define WIDE_STRLEN_CORPUS_X_LIST /* nothing */
+#endif
+
 #define STRLEN_CORPUS_X_LIST \
     X(LIBC_STRLEN, strlen) \
     X(ZOO_STRLEN, zoo::c_strLength) \
     X(ZOO_NATURAL_STRLEN, zoo::c_strLength_natural) \
+    WIDE_STRLEN_CORPUS_X_LIST \
     X(GENERIC_GLIBC_STRLEN, STRLEN_old) \
+    X(ZOO_DISPATCHED_STRLEN, zoo::c_strLength_dispatched) \
     AVX2_STRLEN_CORPUS_X_LIST \
+    AVX512_STRLEN_CORPUS_X_LIST \
     NEON_STRLEN_CORPUS_X_LIST
 
 struct CorpusLeadingSpaces {
@@ -320,6 +337,7 @@ int64_t zooAtoi(const char *s) { return zoo::c_strToI(s); }
     X(ZOO_c_strToI, zoo::c_strToI) \
     X(ZOO_c_strToL, zoo::c_strToL) \
     X(ZOO_c_strToL_uint128_t, zoo::c_strToL128) \
+    X(ZOO_c_strToL_dispatched, zoo::c_strToL_dispatched) \
     X(GLIBC_ATOL, atoll) \
     X(COMPARE_ATOI, zoo::compareAtol<zooAtoi>) \
     X(COMPARE_ATOL, zoo::compareAtol<zoo::c_strToL>) \
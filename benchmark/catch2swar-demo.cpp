@@ -79,10 +79,15 @@ TEST_CASE("Atoi benchmarks", "[atoi][swar]") {
     #if ZOO_CONFIGURED_TO_USE_AVX()
         REQUIRE(fromZOO_AVX == fromZOO_STRLEN);
     #endif
+    #if ZOO_CONFIGURED_TO_USE_AVX512()
+        REQUIRE(fromZOO_AVX512 == fromZOO_STRLEN);
+    #endif
+    REQUIRE(fromZOO_DISPATCHED_STRLEN == fromZOO_STRLEN);
     
     REQUIRE(fromZooSpaces == fromGLIB_Spaces);
 
     REQUIRE(fromGLIBC_atoi == fromZOO_c_strToI);
+    REQUIRE(fromZOO_c_strToL_uint128_t == fromZOO_c_strToL_dispatched);
 
     auto haveTheRoleOfMemoryBarrier = -1;
     #define X(Type, Fun) \
@@ -0,0 +1,117 @@
+#include "zoo/map/RobinHood.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/*! \file AutoTune.cpp
+\brief Validation of \c AutoTunedConfiguration
+
+For a few table sizes, loads and key types, lookups (half hits, half misses)
+are measured with the configuration chosen by \c AutoTunedConfiguration
+against the alternatives: the other lane width, and one PSL bit more or less
+than chosen.  The "deep/lookup" counter reports the deep key comparisons per
+lookup, the quantity the configuration tries to minimize jointly with the
+metadata reads.  A configuration whose PSL encoding is exhausted is reported
+as an error.
+*/
+
+namespace {
+
+std::size_t g_deepComparisons = 0;
+
+template<typename K>
+struct CountingEquality {
+    bool operator()(const K &a, const K &b) const noexcept {
+        ++g_deepComparisons;
+        return a == b;
+    }
+};
+
+template<typename Key>
+Key makeKey(std::uint64_t v) {
+    if constexpr(std::is_same_v<Key, std::string>) {
+        return "key:" + std::to_string(v);
+    } else {
+        return Key(v);
+    }
+}
+
+enum Alternative { Chosen, OtherLaneWidth, OneMorePSLBit, OneLessPSLBit };
+
+template<typename Key, std::size_t Size, int LoadPercent, Alternative A>
+struct Configuration {
+    using AT = zoo::rh::AutoTunedConfiguration<Size, LoadPercent, Key>;
+    constexpr static inline int
+        LaneBits =
+            OtherLaneWidth == A ? (8 == AT::LaneBits ? 16 : 8) : AT::LaneBits,
+        PSL_Bits =
+            OtherLaneWidth == A ?
+                (8 == AT::LaneBits ? AT::Wide.pslBits : AT::Narrow.pslBits) :
+            OneMorePSLBit == A ? AT::PSL_Bits + 1 :
+            OneLessPSLBit == A ? AT::PSL_Bits - 1 :
+                AT::PSL_Bits,
+        HashBits = LaneBits - PSL_Bits;
+};
+
+template<typename Key, std::size_t Size, int LoadPercent, Alternative A>
+void autoTunedLookups(benchmark::State &s) {
+    using C = Configuration<Key, Size, LoadPercent, A>;
+    if constexpr(C::HashBits < 1 || C::PSL_Bits < 2) {
+        s.SkipWithError("Not a valid configuration");
+        for(auto _: s) {}
+    } else {
+        using RH =
+            zoo::rh::RH_Frontend_WithSkarupkeTail<
+                Key, int, Size, C::PSL_Bits, C::HashBits,
+                std::hash<Key>, CountingEquality<Key>
+            >;
+        auto table = std::make_unique<RH>();
+        std::mt19937_64 g(Size);
+        std::vector<Key> probes;
+        try {
+            for(auto count = Size * LoadPercent / 100; count--; ) {
+                auto v = g();
+                table->insert(std::pair{makeKey<Key>(v), 1});
+                probes.push_back(makeKey<Key>(v));
+                probes.push_back(makeKey<Key>(g()));
+            }
+        } catch(zoo::rh::MaximumProbeSequenceLengthExceeded &) {
+            s.SkipWithError("Maximum PSL exceeded");
+            for(auto _: s) {}
+            return;
+        }
+        std::shuffle(probes.begin(), probes.end(), g);
+        std::size_t found = 0, position = 0, lookups = 0;
+        g_deepComparisons = 0;
+        for(auto _: s) {
+            for(auto count = 1024; count--; ) {
+                found += table->end() != table->find(probes[position]);
+                position = (position + 1) % probes.size();
+            }
+            lookups += 1024;
+            benchmark::DoNotOptimize(found);
+        }
+        s.SetItemsProcessed(lookups);
+        s.counters["lane"] = C::LaneBits;
+        s.counters["psl"] = C::PSL_Bits;
+        s.counters["deep/lookup"] = double(g_deepComparisons) / lookups;
+    }
+}
+
+}
+
+#define SCENARIO_X_LIST \
+    Y(int, 4096, 50) Y(int, 4096, 90) \
+    Y(int, 1 << 20, 50) Y(int, 1 << 20, 90) Y(int, 1 << 20, 95) \
+    Y(std::string, 1 << 16, 50) Y(std::string, 1 << 16, 90)
+
+#define X(K, S, L, A) BENCHMARK_TEMPLATE(autoTunedLookups, K, S, L, A);
+#define Y(K, S, L) X(K, S, L, Chosen) X(K, S, L, OtherLaneWidth) X(K, S, L, OneMorePSLBit) X(K, S, L, OneLessPSLBit)
+SCENARIO_X_LIST
+#undef Y
+#undef X
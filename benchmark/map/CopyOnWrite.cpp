@@ -0,0 +1,62 @@
+#include "zoo/map/RobinHoodCopyOnWrite.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+/*! \file CopyOnWrite.cpp
+\brief Cost of a consistent copy of a table: element by element copy of the
+array storage versus a snapshot of copy-on-write pages, and the cost of the
+first writes after a snapshot
+*/
+
+namespace {
+
+constexpr std::size_t Slots = 1 << 20;
+
+using Arrays = zoo::rh::RH_Frontend_WithSkarupkeTail<int, int, Slots, 7, 9>;
+using Pages = zoo::rh::RH_Frontend_CopyOnWrite<int, int, Slots, 7, 9>;
+
+template<typename Table>
+std::unique_ptr<Table> filled() {
+    auto rv = std::make_unique<Table>();
+    std::mt19937 g(Slots);
+    for(auto count = Slots * 3 / 4; count--; ) {
+        rv->insert(std::pair{int(g()), 1});
+    }
+    return rv;
+}
+
+template<typename Table>
+void consistentCopy(benchmark::State &s) {
+    auto table = filled<Table>();
+    for(auto _: s) {
+        auto copy = std::make_unique<Table>(*table);
+        benchmark::DoNotOptimize(copy.get());
+    }
+}
+
+/// Snapshot followed by the number of writes in the argument, to mapped
+/// values of random keys present
+void snapshotThenWrites(benchmark::State &s) {
+    auto table = filled<Pages>();
+    std::mt19937 keys(Slots), g(1);
+    std::vector<int> present;
+    for(auto count = Slots * 3 / 4; count--; ) { present.push_back(int(keys())); }
+    std::uniform_int_distribution<std::size_t> which(0, present.size() - 1);
+    for(auto _: s) {
+        auto view = zoo::rh::snapshot(*table);
+        for(auto count = s.range(0); count--; ) {
+            table->find(present[which(g)])->second += 1;
+        }
+        benchmark::DoNotOptimize(view.get());
+    }
+}
+
+}
+
+BENCHMARK_TEMPLATE(consistentCopy, Arrays);
+BENCHMARK_TEMPLATE(consistentCopy, Pages);
+BENCHMARK(snapshotThenWrites)->Arg(1)->Arg(16)->Arg(256);
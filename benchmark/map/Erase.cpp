@@ -0,0 +1,132 @@
+#include "zoo/map/RobinHood.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/*! \file Erase.cpp
+\brief \c erase, which rotates the runs of the same home index of elements
+that are not trivially relocatable and shifts the others with \c memmove,
+versus the classic backward shift of every element of the cluster
+
+The keys are clustered: runs of \c ClusterSize consecutive keys have the same
+hash.  Each iteration erases a batch of distinct present keys; then, with the
+timing paused, inserts them back to keep the load at 75%.  The
+"moves/erase" counter reports the elements moved per erasure by the classic
+backward shift.
+*/
+
+namespace {
+
+template<int ClusterSize>
+struct ClusteringHash {
+    std::size_t operator()(int k) const noexcept {
+        return std::hash<int>{}(k / ClusterSize);
+    }
+};
+
+constexpr std::size_t Slots = 1 << 16;
+
+template<typename MV>
+MV makeValue(int k) {
+    if constexpr(std::is_same_v<MV, std::string>) {
+        return "a value long enough to not be small: " + std::to_string(k);
+    } else {
+        return MV(k);
+    }
+}
+
+std::size_t g_moves = 0;
+
+/// Moves every element of the cluster after \c index back one slot
+template<typename RH>
+void backwardShiftEraseAt(RH &t, std::size_t index) {
+    using MD = typename RH::MD;
+    auto pslAt = [&](std::size_t i) {
+        return t.metadata(i / MD::NSlots).PSLs().at(i % MD::NSlots);
+    };
+    auto blit = [&](std::size_t i, std::uint64_t e) {
+        auto sI = i / MD::NSlots;
+        t.setMetadata(sI, t.metadata(sI).blitElement(i % MD::NSlots, e));
+    };
+    t.writableSlot(index).destroy();
+    auto hole = index;
+    for(;;) {
+        auto next = hole + 1;
+        auto psl = pslAt(next);
+        if(psl < 2) { break; }
+        auto &source = t.writableSlot(next);
+        t.writableSlot(hole).build(std::move(source.value()));
+        source.destroy();
+        auto hash = t.metadata(next / MD::NSlots).hashes().at(next % MD::NSlots);
+        blit(hole, hash | (psl - 1));
+        hole = next;
+        ++g_moves;
+    }
+    blit(hole, 0);
+    --t.elementCount_;
+}
+
+constexpr std::size_t Batch = 256;
+
+template<bool Zoo, int ClusterSize, typename MV>
+void erase(benchmark::State &s) {
+    using RH =
+        zoo::rh::RH_Frontend_WithSkarupkeTail<
+            int, MV, Slots, 8, 8, ClusteringHash<ClusterSize>
+        >;
+    auto table = std::make_unique<RH>();
+    std::mt19937 g(ClusterSize);
+    std::vector<int> keys;
+    // a key space denser than the table makes most clusters complete
+    std::uniform_int_distribution<int> key(0, Slots);
+    while(table->elementCount_ < Slots * 3 / 4) {
+        auto k = key(g);
+        if(table->insert(std::pair{k, makeValue<MV>(k)}).second) {
+            keys.push_back(k);
+        }
+    }
+    // consecutive batches of the shuffled keys are distinct keys
+    std::shuffle(keys.begin(), keys.end(), g);
+    std::size_t batchStart = 0;
+    g_moves = 0;
+    for(auto _: s) {
+        if(keys.size() < batchStart + Batch) { batchStart = 0; }
+        auto batch = keys.data() + batchStart;
+        for(auto k = batch; k != batch + Batch; ++k) {
+            if constexpr(Zoo) {
+                table->erase(*k);
+            } else {
+                auto [hoisted, homeIndex, kc] = table->findParameters(*k);
+                auto [index, found] =
+                    table->findIndexKnowingParameters(hoisted, homeIndex, kc);
+                backwardShiftEraseAt(*table, index);
+            }
+        }
+        s.PauseTiming();
+        for(auto k = batch; k != batch + Batch; ++k) {
+            table->insert(std::pair{*k, makeValue<MV>(*k)});
+        }
+        batchStart += Batch;
+        s.ResumeTiming();
+    }
+    s.SetItemsProcessed(s.iterations() * Batch);
+    if(!Zoo) {
+        s.counters["moves/erase"] = double(g_moves) / (s.iterations() * Batch);
+    }
+}
+
+}
+
+#define CLUSTER_SIZE_X_LIST X(1) X(4) X(16)
+#define X(C) \
+    BENCHMARK_TEMPLATE(erase, false, C, int); \
+    BENCHMARK_TEMPLATE(erase, true, C, int); \
+    BENCHMARK_TEMPLATE(erase, false, C, std::string); \
+    BENCHMARK_TEMPLATE(erase, true, C, std::string);
+CLUSTER_SIZE_X_LIST
+#undef X
@@ -0,0 +1,73 @@
+#include "zoo/map/RobinHood.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+/*! \file Merge.cpp
+\brief Merging two tables with \c merge_with versus the naive reinsertion of
+the elements of both into a fresh table, adding the mapped values of the keys
+present in both
+*/
+
+namespace {
+
+template<std::size_t Slots>
+using RH = zoo::rh::RH_Frontend_WithSkarupkeTail<int, int, Slots, 6, 2>;
+
+template<typename Table>
+struct Operands {
+    std::unique_ptr<Table> left_, right_;
+
+    Operands(std::size_t elementCount):
+        left_(std::make_unique<Table>()), right_(std::make_unique<Table>())
+    {
+        std::mt19937 g(elementCount);
+        for(auto count = elementCount; count--; ) {
+            left_->insert(typename Table::value_type(g(), 1));
+            right_->insert(typename Table::value_type(g(), 1));
+        }
+    }
+};
+
+template<typename Table>
+void reinsert(Table &destination, const Table &source) {
+    source.traverse([&](std::size_t sI, std::size_t intra) {
+        auto &v = source.slot(intra + sI * Table::MD::NSlots).value();
+        auto ir = destination.insert(v);
+        if(!ir.second) { ir.first->second += v.second; }
+    });
+}
+
+template<typename Table>
+void naiveReinsertion(benchmark::State &s) {
+    Operands<Table> operands(s.range(0));
+    for(auto _: s) {
+        auto fresh = std::make_unique<Table>();
+        reinsert(*fresh, *operands.left_);
+        reinsert(*fresh, *operands.right_);
+        benchmark::DoNotOptimize(fresh->elementCount_);
+    }
+    s.SetItemsProcessed(s.iterations() * 2 * s.range(0));
+}
+
+template<typename Table>
+void mergeWith(benchmark::State &s) {
+    Operands<Table> operands(s.range(0));
+    auto addition = [](int &mine, int theirs) { mine += theirs; };
+    for(auto _: s) {
+        auto fresh = std::make_unique<Table>();
+        fresh->merge_with(*operands.left_, addition);
+        fresh->merge_with(*operands.right_, addition);
+        benchmark::DoNotOptimize(fresh->elementCount_);
+    }
+    s.SetItemsProcessed(s.iterations() * 2 * s.range(0));
+}
+
+}
+
+BENCHMARK_TEMPLATE(naiveReinsertion, RH<4000>)->Arg(1500);
+BENCHMARK_TEMPLATE(mergeWith, RH<4000>)->Arg(1500);
+BENCHMARK_TEMPLATE(naiveReinsertion, RH<120000>)->Arg(50000);
+BENCHMARK_TEMPLATE(mergeWith, RH<120000>)->Arg(50000);
@@ -0,0 +1,222 @@
+#include "zoo/map/RobinHood.h"
+#include "zoo/map/RobinHoodAlt.h"
+#include "zoo/map/RobinHood_straw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*! \file RobinHood.cpp
+\brief Lookups in the Robin Hood map versus \c std::unordered_map
+
+The matrix is: key type (integers and strings) x memory footprint (from L1 to
+DRAM) x load factor (50 to 95%) x hit ratio (the benchmark argument, in
+percent).  The contenders are:
+1. \c RH_Frontend_WithSkarupkeTail::find,
+2. a search over the metadata of the same table that uses
+<tt>SlotOperations::attemptMatch</tt> as the matching kernel,
+3. \c StrawmanMap, the non-SWAR reference, over \c StrawMetadata,
+4. \c std::unordered_map.
+*/
+
+namespace {
+
+enum Footprint: std::size_t {
+    L1 = std::size_t(16) << 10,
+    L2 = std::size_t(512) << 10,
+    L3 = std::size_t(8) << 20,
+    DRAM = std::size_t(128) << 20
+};
+
+/// PSL bits that support the maximum PSL for the load factor, the rest of
+/// the lane for the hoisted hash
+template<int LoadPercent>
+struct MetadataConfiguration {
+    constexpr static inline int
+        PSL_Bits = LoadPercent <= 75 ? 6 : LoadPercent <= 90 ? 7 : 8,
+        HashBits = LoadPercent <= 75 ? 2 : 16 - PSL_Bits;
+};
+
+template<typename Key>
+Key makeKey(std::uint64_t v) {
+    if constexpr(std::is_same_v<Key, std::string>) {
+        return "key:" + std::to_string(v);
+    } else {
+        return Key(v);
+    }
+}
+
+template<typename Key, Footprint F, int LoadPercent>
+struct Scenario {
+    using Configuration = MetadataConfiguration<LoadPercent>;
+    using Value = std::pair<Key, int>;
+    constexpr static inline std::size_t
+        Slots = F / (sizeof(Value) + 1),
+        ElementCount = Slots * LoadPercent / 100,
+        ProbeCount = 1 << 16;
+    using RH =
+        zoo::rh::RH_Frontend_WithSkarupkeTail<
+            Key, int, Slots,
+            Configuration::PSL_Bits, Configuration::HashBits
+        >;
+    constexpr static inline auto StrawHashBits =
+        Configuration::HashBits < 8 ? Configuration::HashBits : 8;
+    using Straw =
+        zoo::rh::StrawmanMap<
+            Configuration::PSL_Bits, StrawHashBits, std::uint64_t,
+            RH::SlotCount,
+            std::hash<std::uint64_t>,
+            zoo::rh::FibonacciScatter<std::uint64_t>,
+            zoo::rh::LemireReduce<Slots, std::uint64_t>,
+            zoo::rh::TopHashReducer<StrawHashBits, std::uint64_t>
+        >;
+
+    std::unique_ptr<RH> rh_;
+    std::unique_ptr<Straw> straw_;
+    std::unordered_map<Key, int> um_;
+    std::vector<std::uint64_t> present_, absent_;
+
+    Scenario(): rh_(std::make_unique<RH>()) {
+        std::mt19937_64 g(Slots * LoadPercent);
+        // odd numbers are never inserted
+        for(auto count = ElementCount; count--; ) {
+            auto v = g() & ~std::uint64_t(1);
+            present_.push_back(v);
+            absent_.push_back(g() | 1);
+        }
+        if constexpr(!std::is_same_v<Key, std::string>) {
+            straw_ = std::make_unique<Straw>();
+        }
+        um_.reserve(ElementCount);
+        for(auto v: present_) {
+            auto k = makeKey<Key>(v);
+            rh_->insert(Value{k, 1});
+            um_.insert(Value{k, 1});
+            if constexpr(!std::is_same_v<Key, std::string>) {
+                straw_->insert(v, [](auto a, auto b) { return a == b; });
+            }
+        }
+    }
+
+    /// Keys to look up, in random order, with the given percentage of hits
+    std::vector<Key> probes(int hitPercent) const {
+        std::mt19937_64 g(hitPercent);
+        std::uniform_int_distribution<std::size_t> which(0, ElementCount - 1);
+        std::uniform_int_distribution<int> percent(0, 99);
+        std::vector<Key> rv;
+        rv.reserve(ProbeCount);
+        for(auto count = ProbeCount; count--; ) {
+            auto &source = percent(g) < hitPercent ? present_ : absent_;
+            rv.push_back(makeKey<Key>(source[which(g)]));
+        }
+        return rv;
+    }
+};
+
+/// Only one scenario is kept alive at a time, the benchmarks of the same
+/// scenario are registered consecutively
+std::shared_ptr<void> g_scenario;
+const void *g_scenarioTag = nullptr;
+
+template<typename S>
+S &scenario() {
+    static const char tag = 0;
+    if(&tag != g_scenarioTag) {
+        g_scenario.reset();
+        g_scenario = std::make_shared<S>();
+        g_scenarioTag = &tag;
+    }
+    return *static_cast<S *>(g_scenario.get());
+}
+
+/// Search in the metadata of a frontend table with
+/// <tt>SlotOperations::attemptMatch</tt>
+template<typename RH, typename Key>
+bool slotOperationsFind(RH &table, const Key &k) {
+    using MD = typename RH::MD;
+    using SO =
+        zoo::rh::SlotOperations<MD::NBitsLeast, MD::NBitsMost, std::uint64_t>;
+    using SM = typename SO::SM;
+    constexpr auto AllNSlots =
+        SM{zoo::meta::BitmaskMaker<std::uint64_t, MD::NSlots, MD::NBits>::value};
+    auto [hoisted, homeIndex, kc] = table.findParameters(k);
+    auto misalignment = homeIndex % MD::NSlots;
+    zoo::MisalignedGenerator_Dynamic<MD> p(
+        table.md_.data() + homeIndex / MD::NSlots,
+        int(MD::NBits * misalignment)
+    );
+    auto needleHashes = broadcast(SM{hoisted << MD::NBitsLeast});
+    auto needlePSLs = SO::needlePSL(0);
+    auto index = homeIndex;
+    for(;;) {
+        auto attempt = SO::attemptMatch(SM{(*p).value()}, needleHashes, needlePSLs);
+        auto matches = SM{attempt.value() & SM::MostSignificantBit};
+        while(matches.value()) {
+            if(kc(index + matches.lsbIndex())) { return true; }
+            matches = SM{zoo::swar::clearLSB(matches.value())};
+        }
+        if(attempt.value() & 1) { return false; }
+        ++p;
+        index += MD::NSlots;
+        needlePSLs = needlePSLs + AllNSlots;
+    }
+}
+
+enum Contender { RobinHood, SlotOperationsKernel, Strawman, UnorderedMap };
+
+template<Contender C, typename Key, Footprint F, int LoadPercent>
+void lookups(benchmark::State &s) {
+    using Sc = Scenario<Key, F, LoadPercent>;
+    auto &sc = scenario<Sc>();
+    auto probes = sc.probes(s.range(0));
+    std::size_t found = 0, position = 0;
+    for(auto _: s) {
+        for(auto count = 1024; count--; ) {
+            auto &key = probes[position];
+            position = (position + 1) % probes.size();
+            if constexpr(RobinHood == C) {
+                found += sc.rh_->end() != sc.rh_->find(key);
+            } else if constexpr(SlotOperationsKernel == C) {
+                found += slotOperationsFind(*sc.rh_, key);
+            } else if constexpr(Strawman == C) {
+                found +=
+                    sc.straw_->exists(key, [](auto a, auto b) { return a == b; });
+            } else {
+                found += sc.um_.end() != sc.um_.find(key);
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    s.SetItemsProcessed(s.iterations() * 1024);
+    s.counters["slots"] = double(Sc::Slots);
+    // validates the contenders agree, should approximate the argument
+    s.counters["hit%"] = 100.0 * found / (s.iterations() * 1024);
+}
+
+}
+
+#define HIT_RATIOS ->Arg(0)->Arg(50)->Arg(100)
+#define FOOTPRINT_X_LIST Y(L1) Y(L2) Y(L3) Y(DRAM)
+#define LOAD_FACTOR_X_LIST(F) X(F, 50) X(F, 75) X(F, 90) X(F, 95)
+
+#define X(F, LF) \
+    BENCHMARK_TEMPLATE(lookups, RobinHood, std::uint64_t, F, LF) HIT_RATIOS; \
+    BENCHMARK_TEMPLATE(lookups, SlotOperationsKernel, std::uint64_t, F, LF) HIT_RATIOS; \
+    BENCHMARK_TEMPLATE(lookups, Strawman, std::uint64_t, F, LF) HIT_RATIOS; \
+    BENCHMARK_TEMPLATE(lookups, UnorderedMap, std::uint64_t, F, LF) HIT_RATIOS;
+#define Y(F) LOAD_FACTOR_X_LIST(F)
+FOOTPRINT_X_LIST
+#undef X
+
+// StrawmanMap only supports integer keys
+#define X(F, LF) \
+    BENCHMARK_TEMPLATE(lookups, RobinHood, std::string, F, LF) HIT_RATIOS; \
+    BENCHMARK_TEMPLATE(lookups, SlotOperationsKernel, std::string, F, LF) HIT_RATIOS; \
+    BENCHMARK_TEMPLATE(lookups, UnorderedMap, std::string, F, LF) HIT_RATIOS;
+FOOTPRINT_X_LIST
+#undef X
+#undef Y
@@ -0,0 +1,133 @@
+#include "zoo/map/StringInterner.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+std::size_t g_allocatedBytes = 0;
+
+/// Allocator that tallies the bytes allocated, to measure the memory used by
+/// the standard library containers
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template<typename O>
+    CountingAllocator(const CountingAllocator<O> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        g_allocatedBytes += n * sizeof(T);
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept {
+        g_allocatedBytes -= n * sizeof(T);
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template<typename O>
+    bool operator==(const CountingAllocator<O> &) const noexcept { return true; }
+    template<typename O>
+    bool operator!=(const CountingAllocator<O> &) const noexcept { return false; }
+};
+
+using CountedString =
+    std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+
+struct CountedStringHash {
+    auto operator()(const CountedString &s) const noexcept {
+        return std::hash<std::string_view>{}(std::string_view{s.data(), s.size()});
+    }
+};
+
+using CountedSet =
+    std::unordered_set<
+        CountedString, CountedStringHash, std::equal_to<CountedString>,
+        CountingAllocator<CountedString>
+    >;
+
+constexpr auto VocabularySize = 50000;
+constexpr auto InterningsPerIteration = 200000;
+using Interner = zoo::rh::StringInterner<65536>;
+
+/// Symbol-like strings of 4 to 24 characters, drawn with repetitions from a
+/// vocabulary
+std::vector<std::string> makeCorpus() {
+    std::mt19937 g(VocabularySize);
+    std::uniform_int_distribution<int>
+        lengths(4, 24), characters('_', 'z'),
+        choice(0, VocabularySize - 1);
+    std::vector<std::string> vocabulary(VocabularySize), rv;
+    for(auto &word: vocabulary) {
+        word.resize(lengths(g));
+        for(auto &c: word) { c = characters(g); }
+    }
+    rv.reserve(InterningsPerIteration);
+    for(auto count = InterningsPerIteration; count--; ) {
+        rv.push_back(vocabulary[choice(g)]);
+    }
+    return rv;
+}
+
+const std::vector<std::string> &corpus() {
+    static auto rv = makeCorpus();
+    return rv;
+}
+
+void reportMemory(benchmark::State &s, std::size_t bytes, std::size_t distinct) {
+    s.counters["bytes"] = double(bytes);
+    s.counters["bytes/string"] = double(bytes) / distinct;
+    s.SetItemsProcessed(s.iterations() * corpus().size());
+}
+
+}
+
+void internStrings_RobinHood(benchmark::State &s) {
+    auto &strings = corpus();
+    std::size_t bytes = 0, distinct = 0;
+    for(auto _: s) {
+        Interner interner;
+        std::size_t checksum = 0;
+        for(auto &str: strings) { checksum += interner.intern(str); }
+        benchmark::DoNotOptimize(checksum);
+        bytes = interner.memoryFootprint();
+        distinct = interner.size();
+    }
+    reportMemory(s, bytes, distinct);
+}
+BENCHMARK(internStrings_RobinHood);
+
+void internStrings_unordered_set(benchmark::State &s) {
+    auto &strings = corpus();
+    std::size_t bytes = 0, distinct = 0;
+    // the key to search for, its capacity reused and not tallied, since
+    // the lookups in C++17 need a key of the type of the set
+    CountedString probe;
+    probe.reserve(64);
+    for(auto _: s) {
+        auto before = g_allocatedBytes;
+        {
+            CountedSet set;
+            std::size_t checksum = 0;
+            for(auto &str: strings) {
+                probe.assign(str.data(), str.size());
+                auto where = set.find(probe);
+                if(set.end() == where) { where = set.insert(probe).first; }
+                // the address is the only stable identifier
+                checksum += reinterpret_cast<std::uintptr_t>(&*where);
+            }
+            benchmark::DoNotOptimize(checksum);
+            bytes = g_allocatedBytes - before + sizeof(set);
+            distinct = set.size();
+        }
+    }
+    reportMemory(s, bytes, distinct);
+}
+BENCHMARK(internStrings_unordered_set);
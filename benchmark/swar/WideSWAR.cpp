@@ -0,0 +1,102 @@
+#include "zoo/swar/WideSWAR.h"
+#include "words.h"
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/// \file WideSWAR.cpp Throughput of SWARs of 1024 bits, 16 words, compared to
+/// the same operations on each byte
+
+namespace {
+
+using namespace zoo::swar;
+
+using Wide = WideSWAR<8, 16>;
+constexpr auto Bytes = sizeof(Wide::Words);
+
+std::vector<Wide> makeWides(std::size_t count) {
+    return randomBuffer<Wide>(count, 48, [](Wide &w, auto &g) {
+        for(auto &word: w.m_words) { word = g(); }
+    });
+}
+
+/// Lane-wise maximum of consecutive pairs
+template<Implementation I>
+void run_maximum(benchmark::State &s) {
+    auto wides = makeWides(s.range(0));
+    std::vector<Wide> result(wides.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i + 1 < wides.size(); ++i) {
+            if constexpr(Zoo == I) {
+                result[i] = maximum(wides[i], wides[i + 1]);
+            } else {
+                uint8_t a[Bytes], b[Bytes], r[Bytes];
+                memcpy(a, &wides[i], Bytes);
+                memcpy(b, &wides[i + 1], Bytes);
+                for(std::size_t j = 0; j < Bytes; ++j) { r[j] = std::max(a[j], b[j]); }
+                memcpy(&result[i], r, Bytes);
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * wides.size() * Bytes);
+}
+BENCHMARK(run_maximum<Zoo>)->Arg(64);
+BENCHMARK(run_maximum<Scalar>)->Arg(64);
+
+/// Index of the first byte equal to the last byte
+template<Implementation I>
+void run_findFirstEqual(benchmark::State &s) {
+    auto wides = makeWides(s.range(0));
+    std::vector<int> result(wides.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i < wides.size(); ++i) {
+            auto &w = wides[i];
+            auto needle = w.at(Wide::Lanes - 1);
+            if constexpr(Zoo == I) {
+                result[i] = equals(w, broadcast(Wide{{needle}})).lsbIndex();
+            } else {
+                uint8_t a[Bytes];
+                memcpy(a, &w, Bytes);
+                result[i] = int(std::find(a, a + Bytes, needle) - a);
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * wides.size() * Bytes);
+}
+BENCHMARK(run_findFirstEqual<Zoo>)->Arg(64);
+BENCHMARK(run_findFirstEqual<Scalar>)->Arg(64);
+
+/// Moves of the lanes by counts that are not multiples of the word
+template<Implementation I>
+void run_shiftLanesLeft(benchmark::State &s) {
+    auto wides = makeWides(s.range(0));
+    std::vector<Wide> result(wides.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i < wides.size(); ++i) {
+            auto count = int(3 + i % 64);
+            if constexpr(Zoo == I) {
+                result[i] = wides[i].shiftLanesLeft(count);
+            } else {
+                uint8_t a[Bytes], r[Bytes] = {};
+                memcpy(a, &wides[i], Bytes);
+                memcpy(r + count, a, Bytes - count);
+                memcpy(&result[i], r, Bytes);
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * wides.size() * Bytes);
+}
+BENCHMARK(run_shiftLanesLeft<Zoo>)->Arg(64);
+BENCHMARK(run_shiftLanesLeft<Scalar>)->Arg(64);
+
+}
@@ -0,0 +1,100 @@
+#include "zoo/swar/arithmetic.h"
+#include "words.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/// \file arithmetic.cpp Throughput of the lane-wise arithmetic of
+/// zoo/swar/arithmetic.h on byte lanes, compared to the loops of scalars
+
+namespace {
+
+using namespace zoo::swar;
+using Bytes = SWAR<8, uint64_t>;
+
+std::vector<uint8_t> makeBuffer(std::size_t size, uint64_t seed) {
+    return randomBuffer<uint8_t>(
+        size, seed, [](uint8_t &b, auto &g) { b = uint8_t(g()); }
+    );
+}
+
+int toSigned(uint8_t v) { return 127 < v ? v - 256 : v; }
+
+int clampSigned(int v) { return v < -128 ? -128 : 127 < v ? 127 : v; }
+
+#define LANEWISE_ARITHMETIC_X_LIST \
+    X(saturatingUnsignedSubtraction, a < b ? 0 : a - b) \
+    X(saturatingSignedAddition, clampSigned(toSigned(a) + toSigned(b))) \
+    X(saturatingSignedSubtraction, clampSigned(toSigned(a) - toSigned(b))) \
+    X(signedMaximum, toSigned(a) < toSigned(b) ? b : a) \
+    X(minimum, a < b ? a : b) \
+    X(roundingAverage, (a + b + 1) / 2) \
+    X(absoluteDifference, a < b ? b - a : a - b)
+
+#define X(name, scalarExpression) \
+    template<Implementation I> \
+    void run_##name(benchmark::State &s) { \
+        auto size = s.range(0); \
+        auto left = makeBuffer(size, 40), right = makeBuffer(size, 41); \
+        std::vector<uint8_t> result(size); \
+        for(auto _: s) { \
+            if constexpr(Zoo == I) { \
+                for(auto i = 0; i < size; i += 8) { \
+                    Bytes a, b; \
+                    memcpy(&a.m_v, &left[i], 8); \
+                    memcpy(&b.m_v, &right[i], 8); \
+                    auto r = name(a, b); \
+                    memcpy(&result[i], &r.m_v, 8); \
+                } \
+            } else { \
+                for(auto i = 0; i < size; ++i) { \
+                    int a = left[i], b = right[i]; \
+                    result[i] = uint8_t(scalarExpression); \
+                } \
+            } \
+            benchmark::DoNotOptimize(result.data()); \
+            benchmark::ClobberMemory(); \
+        } \
+        s.SetBytesProcessed(s.iterations() * size); \
+    } \
+    BENCHMARK(run_##name<Zoo>)->Arg(4096); \
+    BENCHMARK(run_##name<Scalar>)->Arg(4096);
+LANEWISE_ARITHMETIC_X_LIST
+#undef X
+
+#define DIVISION_BY_CONSTANT_X_LIST \
+    X(divideByConstant, 10, /) X(moduloByConstant, 7, %)
+
+#define X(name, divisor, scalarOperator) \
+    template<Implementation I> \
+    void run_##name##divisor(benchmark::State &s) { \
+        auto size = s.range(0); \
+        auto dividends = makeBuffer(size, 42); \
+        std::vector<uint8_t> result(size); \
+        for(auto _: s) { \
+            if constexpr(Zoo == I) { \
+                for(auto i = 0; i < size; i += 8) { \
+                    Bytes d; \
+                    memcpy(&d.m_v, &dividends[i], 8); \
+                    auto r = name<divisor>(d); \
+                    memcpy(&result[i], &r.m_v, 8); \
+                } \
+            } else { \
+                for(auto i = 0; i < size; ++i) { \
+                    result[i] = dividends[i] scalarOperator divisor; \
+                } \
+            } \
+            benchmark::DoNotOptimize(result.data()); \
+            benchmark::ClobberMemory(); \
+        } \
+        s.SetBytesProcessed(s.iterations() * size); \
+    } \
+    BENCHMARK(run_##name##divisor<Zoo>)->Arg(4096); \
+    BENCHMARK(run_##name##divisor<Scalar>)->Arg(4096);
+DIVISION_BY_CONSTANT_X_LIST
+#undef X
+
+}
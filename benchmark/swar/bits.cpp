@@ -0,0 +1,88 @@
+#include "zoo/swar/bits.h"
+#include "words.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <vector>
+
+/// \file bits.cpp Throughput of the bit counts and permutations of the lanes
+/// of zoo/swar/bits.h compared to the builtins of the compiler applied to
+/// each lane.  There is no builtin to reverse the bits in GCC.
+
+namespace {
+
+using namespace zoo::swar;
+
+std::vector<uint64_t> makeWords(std::size_t count) {
+    // the random shifts make runs of zeros of different lengths
+    return randomBuffer<uint64_t>(
+        count, 44, [](uint64_t &w, auto &g) { w = g() >> (g() % 8); }
+    );
+}
+
+template<int NB, typename Operation>
+uint64_t eachLane(uint64_t word, Operation &&op) {
+    using S = SWAR<NB, uint64_t>;
+    uint64_t rv = 0;
+    for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+        auto shift = lane * NB;
+        uint64_t v = (word >> shift) & S::LeastSignificantLaneMask;
+        rv |= (op(v) & S::LeastSignificantLaneMask) << shift;
+    }
+    return rv;
+}
+
+#define LANE_BITS_X_LIST \
+    X(clzLanes, v ? __builtin_clzll(v << (64 - NB)) : NB) \
+    X(ctzLanes, v ? __builtin_ctzll(v) : NB) \
+    X(popcountLanes, __builtin_popcountll(v)) \
+    X(byteSwapLanes, __builtin_bswap64(v) >> (64 - NB))
+
+#define X(name, builtinExpression) \
+    template<Implementation I, int NB> \
+    void run_##name(benchmark::State &s) { \
+        auto words = makeWords(s.range(0)); \
+        std::vector<uint64_t> result(words.size()); \
+        for(auto _: s) { \
+            for(std::size_t i = 0; i < words.size(); ++i) { \
+                if constexpr(Zoo == I) { \
+                    result[i] = name(SWAR<NB, uint64_t>{words[i]}).value(); \
+                } else { \
+                    result[i] = eachLane<NB>(words[i], [](uint64_t v) { \
+                        return uint64_t(builtinExpression); \
+                    }); \
+                } \
+            } \
+            benchmark::DoNotOptimize(result.data()); \
+            benchmark::ClobberMemory(); \
+        } \
+        s.SetBytesProcessed(s.iterations() * words.size() * 8); \
+    } \
+    BENCHMARK(run_##name<Zoo, 8>)->Arg(512); \
+    BENCHMARK(run_##name<Builtin, 8>)->Arg(512); \
+    BENCHMARK(run_##name<Zoo, 16>)->Arg(512); \
+    BENCHMARK(run_##name<Builtin, 16>)->Arg(512); \
+    BENCHMARK(run_##name<Zoo, 32>)->Arg(512); \
+    BENCHMARK(run_##name<Builtin, 32>)->Arg(512);
+LANE_BITS_X_LIST
+#undef X
+
+template<int NB>
+void run_reverseBitsInLanes(benchmark::State &s) {
+    auto words = makeWords(s.range(0));
+    std::vector<uint64_t> result(words.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i < words.size(); ++i) {
+            result[i] = reverseBitsInLanes(SWAR<NB, uint64_t>{words[i]}).value();
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * words.size() * 8);
+}
+BENCHMARK(run_reverseBitsInLanes<4>)->Arg(512);
+BENCHMARK(run_reverseBitsInLanes<8>)->Arg(512);
+BENCHMARK(run_reverseBitsInLanes<32>)->Arg(512);
+
+}
@@ -3,6 +3,7 @@
 #include "zoo/pp/platform.h"
 
 #include "zoo/swar/associative_iteration.h"
+#include "zoo/swar/dispatched.h"
 
 #include "benchmark/benchmark.h"
 
@@ -20,6 +21,8 @@ using S = zoo::swar::SWAR<NB, uint64_t>;
 enum ExtractionPrimitive {
     UseBuiltin,
     UseSWAR,
+    UseCompress,
+    UseDispatched,
     UseOldParallelSuffix,
     CompareBuiltinAndSWAR,
     CompareNewAndOldParallelSuffix
@@ -28,7 +31,11 @@ enum ExtractionPrimitive {
 template<int NB, ExtractionPrimitive P>
 S<NB> parallelExtraction(S<NB> i, S<NB> m) {
     if constexpr(UseSWAR == P) {
+        return zoo::swar::impl::compressWithParallelSuffix(i, m);
+    } else if constexpr(UseCompress == P) {
         return compress(i, m);
+    } else if constexpr(UseDispatched == P) {
+        return zoo::swar::compressDispatched(i, m);
     } else if constexpr(UseOldParallelSuffix == P) {
         return zoo::swar::junk::compressWithOldParallelSuffix(i, m);
     } else if constexpr(CompareNewAndOldParallelSuffix == P) {
@@ -83,8 +90,28 @@ S<NB> parallelExtraction(S<NB> i, S<NB> m) {
     }
 }
 
-template<int NB, ExtractionPrimitive EP>
-void runCompressions(benchmark::State &s) {
+enum DepositPrimitive {
+    DepositWithSWAR,
+    DepositWithExpand,
+    DepositDispatched,
+    DepositWithBuiltin
+};
+
+template<int NB, DepositPrimitive P>
+S<NB> parallelDeposit(S<NB> i, S<NB> m) {
+    if constexpr(DepositWithSWAR == P) {
+        return zoo::swar::impl::expandWithParallelSuffix(i, m);
+    } else if constexpr(DepositWithExpand == P) {
+        return expand(i, m);
+    } else if constexpr(DepositDispatched == P) {
+        return zoo::swar::expandDispatched(i, m);
+    } else {
+        return S<NB>{zoo::swar::impl::lanewiseBMI2<NB, true>(i.value(), m.value())};
+    }
+}
+
+template<int NB, typename Operation>
+void runLanewise(benchmark::State &s, Operation &&operation) {
     using S = zoo::swar::SWAR<NB, uint64_t>;
     std::random_device rd;
     std::mt19937_64 g(rd());
@@ -97,26 +124,42 @@ void runCompressions(benchmark::State &s) {
         auto result = 0;
         for(auto c = 1000; c--; ) {
             S input{inputs[c]}, mask{masks[c]};
-            result ^= parallelExtraction<NB, EP>(input, mask).value();
+            result ^= operation(input, mask).value();
         }
         sideEffect = result;
         benchmark::ClobberMemory();
     }
 }
 
+template<int NB, ExtractionPrimitive EP>
+void runCompressions(benchmark::State &s) {
+    runLanewise<NB>(s, parallelExtraction<NB, EP>);
+}
+
+template<int NB, DepositPrimitive DP>
+void runExpansions(benchmark::State &s) {
+    runLanewise<NB>(s, parallelDeposit<NB, DP>);
+}
+
 #define BIT_SIZE_X_LIST X(4) X(8) X(16) X(32) X(64)
 
 #if ZOO_CONFIGURED_TO_USE_BMI()
     #define EXTENSION_LIST(nb) \
         BENCHMARK(runCompressions<nb, UseBuiltin>); \
-        BENCHMARK(runCompressions<nb, CompareBuiltinAndSWAR>);
+        BENCHMARK(runCompressions<nb, CompareBuiltinAndSWAR>); \
+        BENCHMARK(runExpansions<nb, DepositWithBuiltin>);
 #else
     #define EXTENSION_LIST(_)
 #endif
 #define X(nb) \
     BENCHMARK(runCompressions<nb, UseSWAR>); \
+    BENCHMARK(runCompressions<nb, UseCompress>); \
+    BENCHMARK(runCompressions<nb, UseDispatched>); \
     BENCHMARK(runCompressions<nb, UseOldParallelSuffix>); \
     BENCHMARK(runCompressions<nb, CompareNewAndOldParallelSuffix>); \
+    BENCHMARK(runExpansions<nb, DepositWithSWAR>); \
+    BENCHMARK(runExpansions<nb, DepositWithExpand>); \
+    BENCHMARK(runExpansions<nb, DepositDispatched>); \
     EXTENSION_LIST(nb)
 
 BIT_SIZE_X_LIST
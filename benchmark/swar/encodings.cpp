@@ -0,0 +1,183 @@
+#include "zoo/swar/encodings.h"
+#include "words.h"
+
+#include "benchmark/benchmark.h"
+
+#include <array>
+#include <random>
+#include <string>
+
+/// \file encodings.cpp Throughput of the hexadecimal and base64 encoders and
+/// decoders of zoo/swar/encodings.h compared to the conversion of a byte at
+/// a time with tables
+
+namespace {
+
+using namespace zoo::swar;
+
+const char HexDigits[] = "0123456789abcdef";
+const char Base64Alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// The values of the characters, -1 for the characters not in \c alphabet
+std::array<int8_t, 256> inverse(const char *alphabet, bool uppercaseToo) {
+    std::array<int8_t, 256> rv;
+    rv.fill(-1);
+    for(auto i = 0; alphabet[i]; ++i) {
+        rv[(unsigned char)alphabet[i]] = int8_t(i);
+        if(uppercaseToo && 'a' <= alphabet[i]) {
+            rv[(unsigned char)(alphabet[i] - 'a' + 'A')] = int8_t(i);
+        }
+    }
+    return rv;
+}
+
+const auto HexValues = inverse(HexDigits, true);
+const auto Base64Values = inverse(Base64Alphabet, false);
+
+std::size_t scalarEncodeHex(const std::string &in, std::string &out) {
+    auto o = out.data();
+    for(unsigned char c: in) {
+        *o++ = HexDigits[c >> 4];
+        *o++ = HexDigits[c & 0xF];
+    }
+    return o - out.data();
+}
+
+std::size_t scalarDecodeHex(const std::string &in, std::string &out) {
+    if(in.size() % 2) { return InvalidEncoding; }
+    auto o = out.data();
+    int errors = 0;
+    for(std::size_t i = 0; i < in.size(); i += 2) {
+        int high = HexValues[(unsigned char)in[i]],
+            low = HexValues[(unsigned char)in[i + 1]];
+        errors |= high | low;
+        *o++ = char((high << 4) | low);
+    }
+    return errors < 0 ? InvalidEncoding : o - out.data();
+}
+
+std::size_t scalarEncodeBase64(const std::string &in, std::string &out) {
+    auto o = out.data();
+    auto p = reinterpret_cast<const unsigned char *>(in.data());
+    auto size = in.size(), i = std::size_t(0);
+    for(; i + 3 <= size; i += 3) {
+        unsigned group = (p[i] << 16) | (p[i + 1] << 8) | p[i + 2];
+        *o++ = Base64Alphabet[group >> 18];
+        *o++ = Base64Alphabet[(group >> 12) & 0x3F];
+        *o++ = Base64Alphabet[(group >> 6) & 0x3F];
+        *o++ = Base64Alphabet[group & 0x3F];
+    }
+    if(i < size) {
+        unsigned group = p[i] << 16;
+        if(i + 1 < size) { group |= p[i + 1] << 8; }
+        *o++ = Base64Alphabet[group >> 18];
+        *o++ = Base64Alphabet[(group >> 12) & 0x3F];
+        *o++ = i + 1 < size ? Base64Alphabet[(group >> 6) & 0x3F] : '=';
+        *o++ = '=';
+    }
+    return o - out.data();
+}
+
+std::size_t scalarDecodeBase64(const std::string &in, std::string &out) {
+    auto size = in.size();
+    if(size % 4) { return InvalidEncoding; }
+    for(auto padding = 0; padding < 2 && size && '=' == in[size - 1]; ++padding) {
+        --size;
+    }
+    auto o = out.data();
+    int errors = 0;
+    unsigned group = 0;
+    for(std::size_t i = 0; i < size; ++i) {
+        int value = Base64Values[(unsigned char)in[i]];
+        errors |= value;
+        group = (group << 6) | (value & 0x3F);
+        if(3 == i % 4) {
+            *o++ = char(group >> 16);
+            *o++ = char(group >> 8);
+            *o++ = char(group);
+        }
+    }
+    switch(size % 4) {
+        case 2: *o++ = char(group >> 4); break;
+        case 3: *o++ = char(group >> 10); *o++ = char(group >> 2); break;
+    }
+    return errors < 0 ? InvalidEncoding : o - out.data();
+}
+
+std::string makeBytes(std::size_t size) {
+    std::mt19937_64 g(50);
+    std::string rv(size, '\0');
+    for(auto &c: rv) { c = char(g()); }
+    return rv;
+}
+
+constexpr auto Size = std::size_t(1) << 14;
+
+template<Implementation I>
+void run_encodeHex(benchmark::State &s) {
+    auto bytes = makeBytes(Size);
+    std::string text(hexEncodedSize(Size), '\0');
+    for(auto _: s) {
+        std::size_t count;
+        if constexpr(Zoo == I) { count = encodeHex(bytes, text); }
+        else { count = scalarEncodeHex(bytes, text); }
+        benchmark::DoNotOptimize(count);
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * bytes.size());
+}
+BENCHMARK(run_encodeHex<Zoo>);
+BENCHMARK(run_encodeHex<Scalar>);
+
+template<Implementation I>
+void run_decodeHex(benchmark::State &s) {
+    auto bytes = makeBytes(Size);
+    std::string text(hexEncodedSize(Size), '\0');
+    encodeHex(bytes, text);
+    for(auto _: s) {
+        std::size_t count;
+        if constexpr(Zoo == I) { count = decodeHex(text, bytes); }
+        else { count = scalarDecodeHex(text, bytes); }
+        benchmark::DoNotOptimize(count);
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * bytes.size());
+}
+BENCHMARK(run_decodeHex<Zoo>);
+BENCHMARK(run_decodeHex<Scalar>);
+
+template<Implementation I>
+void run_encodeBase64(benchmark::State &s) {
+    auto bytes = makeBytes(Size);
+    std::string text(base64EncodedSize(Size), '\0');
+    for(auto _: s) {
+        std::size_t count;
+        if constexpr(Zoo == I) { count = encodeBase64(bytes, text); }
+        else { count = scalarEncodeBase64(bytes, text); }
+        benchmark::DoNotOptimize(count);
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * bytes.size());
+}
+BENCHMARK(run_encodeBase64<Zoo>);
+BENCHMARK(run_encodeBase64<Scalar>);
+
+template<Implementation I>
+void run_decodeBase64(benchmark::State &s) {
+    auto bytes = makeBytes(Size);
+    std::string text(base64EncodedSize(Size), '\0');
+    encodeBase64(bytes, text);
+    for(auto _: s) {
+        std::size_t count;
+        if constexpr(Zoo == I) { count = decodeBase64(text, bytes); }
+        else { count = scalarDecodeBase64(text, bytes); }
+        benchmark::DoNotOptimize(count);
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * bytes.size());
+}
+BENCHMARK(run_decodeBase64<Zoo>);
+BENCHMARK(run_decodeBase64<Scalar>);
+
+}
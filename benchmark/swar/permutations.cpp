@@ -0,0 +1,204 @@
+#include "zoo/swar/permutations.h"
+#include "words.h"
+
+#include "benchmark/benchmark.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/// \file permutations.cpp Throughput of the moves of lanes of
+/// zoo/swar/permutations.h compared to moving the lanes one by one.
+
+namespace {
+
+using namespace zoo::swar;
+
+template<int NB, int... Indices>
+uint64_t scalarPermutation(uint64_t word) {
+    using S = SWAR<NB, uint64_t>;
+    constexpr int Sources[] = { Indices... };
+    uint64_t rv = 0;
+    for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+        rv |= S{word}.at(Sources[lane]) << (lane * NB);
+    }
+    return rv;
+}
+
+#define PERMUTATION_X_LIST \
+    X(Reversal, 8, 7, 6, 5, 4, 3, 2, 1, 0) \
+    X(Rotation, 8, 1, 2, 3, 4, 5, 6, 7, 0) \
+    X(Gather, 8, 0, 0, 7, 7, 2, 5, 4, 1) \
+    X(Halfwords, 16, 2, 0, 3, 1)
+
+#define X(name, NB, ...) \
+    template<Implementation I> \
+    void run_permute##name(benchmark::State &s) { \
+        auto words = randomWords(s.range(0), 46); \
+        std::vector<uint64_t> result(words.size()); \
+        for(auto _: s) { \
+            for(std::size_t i = 0; i < words.size(); ++i) { \
+                if constexpr(Zoo == I) { \
+                    result[i] = permuteLanes<__VA_ARGS__>(SWAR<NB, uint64_t>{words[i]}).value(); \
+                } else { \
+                    result[i] = scalarPermutation<NB, __VA_ARGS__>(words[i]); \
+                } \
+            } \
+            benchmark::DoNotOptimize(result.data()); \
+            benchmark::ClobberMemory(); \
+        } \
+        s.SetBytesProcessed(s.iterations() * words.size() * 8); \
+    } \
+    BENCHMARK(run_permute##name<Zoo>)->Arg(512); \
+    BENCHMARK(run_permute##name<Scalar>)->Arg(512);
+PERMUTATION_X_LIST
+#undef X
+
+template<Implementation I>
+void run_broadcastLane(benchmark::State &s) {
+    using S = SWAR<8, uint64_t>;
+    auto words = randomWords(s.range(0), 46);
+    std::vector<uint64_t> result(words.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i < words.size(); ++i) {
+            auto lane = int(i % 8);
+            if constexpr(Zoo == I) {
+                result[i] = broadcastLane(S{words[i]}, lane).value();
+            } else {
+                uint64_t v = S{words[i]}.at(lane), rv = 0;
+                for(auto j = 0; j < 8; ++j) { rv |= v << (8 * j); }
+                result[i] = rv;
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * words.size() * 8);
+}
+BENCHMARK(run_broadcastLane<Zoo>)->Arg(512);
+BENCHMARK(run_broadcastLane<Scalar>)->Arg(512);
+
+template<int NB>
+std::array<uint64_t, 2> scalarZip(uint64_t a, uint64_t b) {
+    using S = SWAR<NB, uint64_t>;
+    constexpr int Lanes = S::Lanes;
+    std::array<uint64_t, 2> rv{};
+    for(auto lane = 0; lane < Lanes; ++lane) {
+        auto &destination = rv[2 * lane / Lanes];
+        auto shift = (2 * lane % Lanes) * NB;
+        destination |= S{a}.at(lane) << shift;
+        destination |= S{b}.at(lane) << (shift + NB);
+    }
+    return rv;
+}
+
+template<int NB>
+std::array<uint64_t, 2> scalarUnzip(uint64_t low, uint64_t high) {
+    using S = SWAR<NB, uint64_t>;
+    constexpr int Lanes = S::Lanes;
+    std::array<uint64_t, 2> rv{};
+    for(auto lane = 0; lane < Lanes; ++lane) {
+        auto source = S{lane < Lanes / 2 ? low : high};
+        auto at = 2 * lane % Lanes;
+        rv[0] |= source.at(at) << (lane * NB);
+        rv[1] |= source.at(at + 1) << (lane * NB);
+    }
+    return rv;
+}
+
+/// Zips pairs of consecutive words, and unzips back
+template<Implementation I, int NB>
+void run_zipUnzipLanes(benchmark::State &s) {
+    using S = SWAR<NB, uint64_t>;
+    auto words = randomWords(s.range(0), 46);
+    std::vector<uint64_t> zipped(words.size()), unzipped(words.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i < words.size(); i += 2) {
+            if constexpr(Zoo == I) {
+                auto z = zipLanes(S{words[i]}, S{words[i + 1]});
+                zipped[i] = z.low.value();
+                zipped[i + 1] = z.high.value();
+            } else {
+                auto z = scalarZip<NB>(words[i], words[i + 1]);
+                zipped[i] = z[0];
+                zipped[i + 1] = z[1];
+            }
+        }
+        for(std::size_t i = 0; i < words.size(); i += 2) {
+            if constexpr(Zoo == I) {
+                auto u = unzipLanes(S{zipped[i]}, S{zipped[i + 1]});
+                unzipped[i] = u.even.value();
+                unzipped[i + 1] = u.odd.value();
+            } else {
+                auto u = scalarUnzip<NB>(zipped[i], zipped[i + 1]);
+                unzipped[i] = u[0];
+                unzipped[i + 1] = u[1];
+            }
+        }
+        benchmark::DoNotOptimize(unzipped.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * words.size() * 8);
+}
+BENCHMARK(run_zipUnzipLanes<Zoo, 8>)->Arg(512);
+BENCHMARK(run_zipUnzipLanes<Scalar, 8>)->Arg(512);
+BENCHMARK(run_zipUnzipLanes<Zoo, 16>)->Arg(512);
+BENCHMARK(run_zipUnzipLanes<Scalar, 16>)->Arg(512);
+
+/// Transposes of the blocks of eight words
+template<Implementation I>
+void run_transposeBytes8x8(benchmark::State &s) {
+    auto words = randomWords(s.range(0), 46);
+    std::vector<uint64_t> result(words.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i < words.size(); i += 8) {
+            std::array<uint64_t, 8> rows;
+            for(auto j = 0; j < 8; ++j) { rows[j] = words[i + j]; }
+            if constexpr(Zoo == I) {
+                rows = transposeBytes8x8(rows);
+            } else {
+                std::array<uint64_t, 8> columns{};
+                for(auto r = 0; r < 8; ++r) {
+                    for(auto c = 0; c < 8; ++c) {
+                        columns[c] |= ((rows[r] >> (8 * c)) & 0xFF) << (8 * r);
+                    }
+                }
+                rows = columns;
+            }
+            for(auto j = 0; j < 8; ++j) { result[i + j] = rows[j]; }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * words.size() * 8);
+}
+BENCHMARK(run_transposeBytes8x8<Zoo>)->Arg(512);
+BENCHMARK(run_transposeBytes8x8<Scalar>)->Arg(512);
+
+template<Implementation I>
+void run_transposeBits8x8(benchmark::State &s) {
+    auto words = randomWords(s.range(0), 46);
+    std::vector<uint64_t> result(words.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i < words.size(); ++i) {
+            if constexpr(Zoo == I) {
+                result[i] = transposeBits8x8(words[i]);
+            } else {
+                uint64_t v = words[i], rv = 0;
+                for(auto r = 0; r < 8; ++r) {
+                    for(auto c = 0; c < 8; ++c) {
+                        rv |= ((v >> (8 * r + c)) & 1) << (8 * c + r);
+                    }
+                }
+                result[i] = rv;
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetBytesProcessed(s.iterations() * words.size() * 8);
+}
+BENCHMARK(run_transposeBits8x8<Zoo>)->Arg(512);
+BENCHMARK(run_transposeBits8x8<Scalar>)->Arg(512);
+
+}
@@ -0,0 +1,108 @@
+#include "zoo/swar/ranges.h"
+#include "words.h"
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+/// \file ranges.cpp Throughput of the algorithms of zoo/swar/ranges.h,
+/// reported in bytes per second, compared to the standard library
+
+namespace {
+
+using namespace zoo::swar;
+
+/// Lowercase letters, with the one searched for only at the end
+std::vector<char> makeBuffer(std::size_t size) {
+    auto rv = randomBuffer<char>(
+        size, 38, [](char &c, auto &g) { c = 'a' + g() % 25; }
+    );
+    rv.back() = 'z';
+    return rv;
+}
+
+template<Implementation I>
+auto find(const std::vector<char> &b) {
+    if constexpr(Zoo == I) { return findByte(b, std::byte{'z'}); }
+    else { return std::size_t(std::find(b.begin(), b.end(), 'z') - b.begin()); }
+}
+
+template<Implementation I>
+auto count(const std::vector<char> &b) {
+    if constexpr(Zoo == I) { return countByte(b, std::byte{'a'}); }
+    else { return std::size_t(std::count(b.begin(), b.end(), 'a')); }
+}
+
+template<Implementation I>
+auto firstOf(const std::vector<char> &b) {
+    static constexpr char Set[] = "z{|";
+    if constexpr(Zoo == I) {
+        return findFirstOf(b, ByteSpan(Set, sizeof(Set) - 1));
+    } else {
+        return std::size_t(
+            std::find_first_of(b.begin(), b.end(), Set, Set + sizeof(Set) - 1) -
+            b.begin()
+        );
+    }
+}
+
+template<Implementation I>
+auto allLowercase(const std::vector<char> &b) {
+    if constexpr(Zoo == I) {
+        return allOf(b, [](ByteLanes l) {
+            return
+                constantIsGreaterEqual<'z'>(l) &
+                ~constantIsGreaterEqual<'a' - 1>(l);
+        });
+    } else {
+        return std::all_of(b.begin(), b.end(), [](char c) {
+            return 'a' <= c && c <= 'z';
+        });
+    }
+}
+
+/// After the first iteration there is nothing to replace, all the bytes are
+/// still compared
+template<Implementation I>
+auto replace(std::vector<char> &b) {
+    if constexpr(Zoo == I) { replaceByte(b, std::byte{'a'}, std::byte{'b'}); }
+    else { std::replace(b.begin(), b.end(), 'a', 'b'); }
+    return b.size();
+}
+
+template<Implementation I>
+auto toUppercase(std::vector<char> &b) {
+    // toggles the case back and forth in the iterations
+    if constexpr(Zoo == I) {
+        transformLanes(b, [](ByteLanes l) {
+            return l ^ ByteLanes{0x2020'2020'2020'2020};
+        });
+    } else {
+        std::transform(b.begin(), b.end(), b.begin(), [](char c) {
+            return c ^ 0x20;
+        });
+    }
+    return b.size();
+}
+
+#define RANGE_ALGORITHMS_X_LIST \
+    X(find) X(count) X(firstOf) X(allLowercase) X(replace) X(toUppercase)
+
+#define X(name) \
+    template<Implementation I> \
+    void run_##name(benchmark::State &s) { \
+        auto buffer = makeBuffer(s.range(0)); \
+        for(auto _: s) { \
+            benchmark::DoNotOptimize(name<I>(buffer)); \
+            benchmark::ClobberMemory(); \
+        } \
+        s.SetBytesProcessed(s.iterations() * s.range(0)); \
+    } \
+    BENCHMARK(run_##name<Zoo>)->Arg(64)->Arg(4096)->Arg(1 << 20); \
+    BENCHMARK(run_##name<Standard>)->Arg(64)->Arg(4096)->Arg(1 << 20);
+RANGE_ALGORITHMS_X_LIST
+#undef X
+
+}
@@ -0,0 +1,73 @@
+#include "zoo/swar/sorting.h"
+#include "words.h"
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/// \file sorting.cpp Sorting the lanes of each word of a buffer, 8 bytes or
+/// 4 halfwords, with the sorting networks of zoo/swar/sorting.h compared to
+/// std::sort of the elements of the word
+
+namespace {
+
+using namespace zoo::swar;
+
+template<Implementation I, int NB>
+void run_sortLanes(benchmark::State &s) {
+    using Element = zoo::meta::UInteger<NB>;
+    auto words = randomWords(s.range(0), 45);
+    std::vector<uint64_t> result(words.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i < words.size(); ++i) {
+            if constexpr(Zoo == I) {
+                result[i] = sortLanes(SWAR<NB, uint64_t>{words[i]}).value();
+            } else {
+                Element elements[64 / NB];
+                memcpy(elements, &words[i], 8);
+                std::sort(elements, elements + 64 / NB);
+                memcpy(&result[i], elements, 8);
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetItemsProcessed(s.iterations() * words.size());
+}
+BENCHMARK(run_sortLanes<Zoo, 8>)->Arg(512);
+BENCHMARK(run_sortLanes<Standard, 8>)->Arg(512);
+BENCHMARK(run_sortLanes<Zoo, 16>)->Arg(512);
+BENCHMARK(run_sortLanes<Standard, 16>)->Arg(512);
+
+template<Implementation I>
+void run_mergeSortedLanes(benchmark::State &s) {
+    auto words = randomWords(s.range(0), 45);
+    for(auto &w: words) { w = sortLanes(SWAR<8, uint64_t>{w}).value(); }
+    std::vector<uint64_t> result(words.size());
+    for(auto _: s) {
+        for(std::size_t i = 0; i + 1 < words.size(); i += 2) {
+            if constexpr(Zoo == I) {
+                auto merged = mergeSortedLanes(
+                    SWAR<8, uint64_t>{words[i]}, SWAR<8, uint64_t>{words[i + 1]}
+                );
+                result[i] = merged.lesser.value();
+                result[i + 1] = merged.greater.value();
+            } else {
+                uint8_t bytes[16], merged[16];
+                memcpy(bytes, &words[i], 16);
+                std::merge(bytes, bytes + 8, bytes + 8, bytes + 16, merged);
+                memcpy(&result[i], merged, 16);
+            }
+        }
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    s.SetItemsProcessed(s.iterations() * words.size() / 2);
+}
+BENCHMARK(run_mergeSortedLanes<Zoo>)->Arg(512);
+BENCHMARK(run_mergeSortedLanes<Standard>)->Arg(512);
+
+}
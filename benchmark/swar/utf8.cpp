@@ -0,0 +1,94 @@
+#include "zoo/swar/utf8.h"
+#include "words.h"
+
+#include "benchmark/benchmark.h"
+
+#include <random>
+#include <string>
+
+/// \file utf8.cpp Throughput of the validation of UTF-8 and the count of code
+/// points of zoo/swar/utf8.h compared to a decoder of a code point at a time
+
+namespace {
+
+using namespace zoo::swar;
+
+/// \param mix percentage of code points that are not ASCII, of two, three
+/// and four bytes
+std::string makeText(std::size_t size, int mix) {
+    std::mt19937_64 g(49);
+    std::string rv;
+    while(rv.size() < size) {
+        auto r = g();
+        if(int(r % 100) < mix) {
+            switch((r >> 8) % 3) {
+                case 0: rv += "\xC3\xB1"; break; // U+00F1
+                case 1: rv += "\xE2\x82\xAC"; break; // U+20AC
+                default: rv += "\xF0\x9F\x98\x80"; break; // U+1F600
+            }
+        } else {
+            rv += char('a' + (r >> 8) % 26);
+        }
+    }
+    return rv;
+}
+
+bool scalarValidate(const std::string &text) {
+    auto p = reinterpret_cast<const unsigned char *>(text.data()),
+        end = p + text.size();
+    while(p < end) {
+        unsigned c = *p++;
+        int length;
+        unsigned minimum, codePoint;
+        if(c < 0x80) { continue; }
+        else if(0xC0 == (c & 0xE0)) { length = 1; minimum = 0x80; codePoint = c & 0x1F; }
+        else if(0xE0 == (c & 0xF0)) { length = 2; minimum = 0x800; codePoint = c & 0x0F; }
+        else if(0xF0 == (c & 0xF8)) { length = 3; minimum = 0x10000; codePoint = c & 0x07; }
+        else { return false; }
+        if(end - p < length) { return false; }
+        while(length--) {
+            unsigned next = *p++;
+            if(0x80 != (next & 0xC0)) { return false; }
+            codePoint = (codePoint << 6) | (next & 0x3F);
+        }
+        if(codePoint < minimum || 0x10FFFF < codePoint) { return false; }
+        if(0xD800 <= codePoint && codePoint <= 0xDFFF) { return false; }
+    }
+    return true;
+}
+
+std::size_t scalarCount(const std::string &text) {
+    std::size_t rv = 0;
+    for(auto c: text) { rv += 0x80 != (c & 0xC0); }
+    return rv;
+}
+
+template<Implementation I>
+void run_validateUTF8(benchmark::State &s) {
+    auto text = makeText(1 << 16, int(s.range(0)));
+    for(auto _: s) {
+        bool valid;
+        if constexpr(Zoo == I) { valid = validateUTF8(text); }
+        else { valid = scalarValidate(text); }
+        benchmark::DoNotOptimize(valid);
+    }
+    s.SetBytesProcessed(s.iterations() * text.size());
+}
+BENCHMARK(run_validateUTF8<Zoo>)->Arg(0)->Arg(5)->Arg(50);
+BENCHMARK(run_validateUTF8<Scalar>)->Arg(0)->Arg(5)->Arg(50);
+
+template<Implementation I>
+void run_countCodePoints(benchmark::State &s) {
+    auto text = makeText(1 << 16, int(s.range(0)));
+    for(auto _: s) {
+        std::size_t count;
+        if constexpr(Zoo == I) { count = countCodePoints(text); }
+        else { count = scalarCount(text); }
+        benchmark::DoNotOptimize(count);
+    }
+    s.SetBytesProcessed(s.iterations() * text.size());
+}
+BENCHMARK(run_countCodePoints<Zoo>)->Arg(50);
+BENCHMARK(run_countCodePoints<Scalar>)->Arg(50);
+
+}
@@ -0,0 +1,31 @@
+#ifndef ZOO_BENCHMARK_SWAR_WORDS
+#define ZOO_BENCHMARK_SWAR_WORDS
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/// \file words.h The buffers of random elements the benchmarks of the SWAR
+/// operations run on, and the implementations they compare
+
+/// The SWAR operation of zoo, or what it is compared to: a loop over the
+/// lanes, the standard library or the builtins of the compiler
+enum Implementation { Zoo, Scalar, Standard, Builtin };
+
+/// \c count elements set by \c fill from a generator seeded with \c seed, the
+/// same in every run
+template<typename Element, typename Fill>
+std::vector<Element> randomBuffer(std::size_t count, uint64_t seed, Fill &&fill) {
+    std::mt19937_64 g(seed);
+    std::vector<Element> rv(count);
+    for(auto &e: rv) { fill(e, g); }
+    return rv;
+}
+
+inline std::vector<uint64_t> randomWords(std::size_t count, uint64_t seed) {
+    return randomBuffer<uint64_t>(
+        count, seed, [](uint64_t &w, std::mt19937_64 &g) { w = g(); }
+    );
+}
+
+#endif
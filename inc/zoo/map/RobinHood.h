@@ -2,6 +2,7 @@
 #define ZOO_ROBINHOOD_H
 
 #include "zoo/map/RobinHoodUtil.h"
+#include "zoo/meta/relocatable.h"
 #include "zoo/AlignedStorage.h"
 
 #ifndef ZOO_CONFIG_DEEP_ASSERTIONS
@@ -10,8 +11,10 @@
 
 #include <tuple>
 #include <array>
+#include <cstring>
 #include <functional>
 #include <stdexcept>
+#include <type_traits>
 
 #if ZOO_CONFIG_DEEP_ASSERTIONS
     #include <assert>
@@ -69,12 +72,18 @@ struct RelocationStackExhausted: RobinHoodException {
 };
 
 /// \brief The canonical backend (implementation)
-template<int PSL_Bits, int HashBits, typename U = std::uint64_t>
+///
+/// The metadata is read through \c MetadataCursor, a pointer by default, or
+/// anything that can be indexed and incremented like one
+template<
+    int PSL_Bits, int HashBits, typename U = std::uint64_t,
+    typename MetadataCursor = const impl::Metadata<PSL_Bits, HashBits, U> *
+>
 struct RH_Backend {
     using Metadata = impl::Metadata<PSL_Bits, HashBits, U>;
 
     constexpr static inline auto Width = Metadata::NBits;
-    Metadata *md_;
+    MetadataCursor md_;
 
     /// Boolean SWAR true in the first element/lane of the needle strictly
     /// poorer than its corresponding haystack
@@ -183,11 +192,14 @@ struct RH_Backend {
     ) const noexcept __attribute__((always_inline));
 };
 
-template<int PSL_Bits, int HashBits, typename U>
+template<int PSL_Bits, int HashBits, typename U, typename MetadataCursor>
 template<typename KeyComparer>
 inline constexpr
-std::tuple<std::size_t, U, typename RH_Backend<PSL_Bits, HashBits, U>::Metadata>
-RH_Backend<PSL_Bits, HashBits, U>::findMisaligned_assumesSkarupkeTail(
+std::tuple<
+    std::size_t, U,
+    typename RH_Backend<PSL_Bits, HashBits, U, MetadataCursor>::Metadata
+>
+RH_Backend<PSL_Bits, HashBits, U, MetadataCursor>::findMisaligned_assumesSkarupkeTail(
         U hoistedHash, int homeIndex, const KeyComparer &kc
     ) const noexcept {
         auto misalignment = homeIndex % Metadata::NSlots;
@@ -198,7 +210,8 @@ RH_Backend<PSL_Bits, HashBits, U>::findMisaligned_assumesSkarupkeTail(
         constexpr auto Progression = Metadata{Ones * Ones};
         constexpr auto AllNSlots =
             Metadata{meta::BitmaskMaker<U, Metadata::NSlots, Width>::value};
-        MisalignedGenerator_Dynamic<Metadata> p(base, int(Metadata::NBits * misalignment));
+        MisalignedGenerator_Dynamic<Metadata, MetadataCursor>
+            p(base, int(Metadata::NBits * misalignment));
         auto index = homeIndex;
         auto needle = makeNeedle(0, hoistedHash);
 
@@ -291,6 +304,124 @@ struct KeyValuePairWrapper {
     const auto &value() const noexcept { return const_cast<KeyValuePairWrapper *>(this)->value(); }
 };
 
+namespace impl {
+
+/// Calls <tt>c(swarIndex, intraIndex)</tt> for each occupied slot of the
+/// \c swarCount metadata SWARs that \c md returns by index
+template<typename MetadataAccessor, typename Callable>
+void traverseOccupied(
+    std::size_t swarCount, const MetadataAccessor &md, Callable &&c
+) {
+    for(std::size_t swarIndex = 0; swarIndex < swarCount; ++swarIndex) {
+        auto occupied = booleans(md(swarIndex).PSLs());
+        while(occupied) {
+            auto intraIndex = occupied.lsbIndex();
+            c(swarIndex, intraIndex);
+            occupied = occupied.clearLSB();
+        }
+    }
+}
+
+} // impl
+
+/// \brief Storage policy of the frontend: the metadata and the slots are
+/// arrays inside the table
+///
+/// A storage policy provides the template \c Collection of the metadata
+/// SWARs and slots for at least \c MinimumSlots slots, the frontend accesses
+/// them only through:
+/// 1. \c metadata(swarIndex) and \c slot(index), to read,
+/// 2. \c setMetadata(swarIndex, md) and \c writableSlot(index), to write,
+/// 3. \c metadataCursor(), the pointer-like cursor for the backend,
+/// 4. \c ContiguousSlots, whether the slots are an array, so that
+/// \c writableSlot does not copy and the addresses of the slots are
+/// comparable.
+/// The collection is responsible for the lifetime of the elements; moving
+/// leaves the donor empty.
+///
+/// Elements trivially copy constructible are copied, and trivially
+/// relocatable relocated, with a single \c memcpy of the slots, see
+/// \c meta::is_trivially_relocatable
+struct ArrayStorage {
+    template<typename MD, typename Slot, std::size_t MinimumSlots>
+    struct Collection {
+        constexpr static inline std::size_t
+            SWARCount = (MinimumSlots + MD::NSlots - 1) / MD::NSlots,
+            SlotCount = SWARCount * MD::NSlots;
+        constexpr static inline bool ContiguousSlots = true;
+
+        using MetadataCursor = const MD *;
+        using MetadataCollection = std::array<MD, SWARCount>;
+
+        MetadataCollection md_;
+        std::array<Slot, SlotCount> values_;
+
+        Collection() noexcept {
+            for(auto &mde: md_) { mde = MD{0}; }
+        }
+
+        template<typename Callable>
+        void traverse(Callable &&c) const {
+            impl::traverseOccupied(
+                SWARCount,
+                [thy = this](std::size_t sI) { return thy->md_[sI]; },
+                std::forward<Callable>(c)
+            );
+        }
+
+        ~Collection() {
+            traverse([thy = this](std::size_t sI, std::size_t intra) {
+                thy->values_[intra + sI * MD::NSlots].destroy();
+            });
+        }
+
+        using value_type = typename Slot::type;
+        constexpr static inline bool
+            BitwiseCopy = std::is_trivially_copy_constructible_v<value_type>,
+            BitwiseRelocation = meta::is_trivially_relocatable_v<value_type>;
+
+        Collection(const Collection &model): Collection() {
+            if constexpr(BitwiseCopy) {
+                memcpy(
+                    static_cast<void *>(values_.data()), model.values_.data(),
+                    sizeof(values_)
+                );
+                md_ = model.md_;
+                return;
+            }
+            model.traverse([thy = this, other = &model](std::size_t sI, std::size_t intra) {
+                auto index = intra + sI * MD::NSlots;
+                thy->values_[index].build(other->values_[index].value());
+                thy->md_[sI] =
+                    thy->md_[sI].blitElement(intra, other->md_[sI].at(intra));
+            });
+        }
+
+        Collection(Collection &&donor) noexcept: md_(donor.md_) {
+            if constexpr(BitwiseRelocation) {
+                memcpy(
+                    static_cast<void *>(values_.data()), donor.values_.data(),
+                    sizeof(values_)
+                );
+            } else {
+                traverse([thy = this, other = &donor](std::size_t sI, std::size_t intra) {
+                    auto index = intra + sI * MD::NSlots;
+                    auto &source = other->values_[index];
+                    thy->values_[index].build(std::move(source.value()));
+                    source.destroy();
+                });
+            }
+            for(auto &mde: donor.md_) { mde = MD{0}; }
+        }
+
+        MetadataCursor metadataCursor() const noexcept { return md_.data(); }
+        MD metadata(std::size_t swarIndex) const noexcept { return md_[swarIndex]; }
+        void setMetadata(std::size_t swarIndex, MD md) noexcept { md_[swarIndex] = md; }
+        const Slot &slot(std::size_t index) const noexcept { return values_[index]; }
+        Slot &writableSlot(std::size_t index) noexcept { return values_[index]; }
+    };
+};
+
 /// \brief Frontend with the "Skarupke Tail"
 ///
 /// Normally we need to explicitly check for whether key searches have reached
@@ -300,6 +431,9 @@ struct KeyValuePairWrapper {
 /// by just adding an extra maximum PSL entries to the table, while keeping the
 /// slot indexing function the same, searches at the end of the table will never
 /// attempt to go past the real end, but return not-found within the tail.
+///
+/// Where the metadata and the slots are stored is the \c Storage policy, see
+/// \c ArrayStorage
 template<
     typename K,
     typename MV,
@@ -310,10 +444,26 @@ template<
     typename U = std::uint64_t,
     typename Scatter = FibonacciScatter<U>,
     typename RangeReduce = LemireReduce<RequestedSize_, U>,
-    typename HashReduce = TopHashReducer<HashBits, U>
+    typename HashReduce = TopHashReducer<HashBits, U>,
+    typename Storage = ArrayStorage
 >
-struct RH_Frontend_WithSkarupkeTail {
-    using Backend = RH_Backend<PSL_Bits, HashBits, U>;
+struct RH_Frontend_WithSkarupkeTail:
+    Storage::template Collection<
+        impl::Metadata<PSL_Bits, HashBits, U>,
+        KeyValuePairWrapper<K, MV>,
+        RequestedSize_ + (1 << PSL_Bits)
+    >
+{
+    using Collection =
+        typename Storage::template Collection<
+            impl::Metadata<PSL_Bits, HashBits, U>,
+            KeyValuePairWrapper<K, MV>,
+            RequestedSize_ + (1 << PSL_Bits)
+        >;
+    using Backend =
+        RH_Backend<
+            PSL_Bits, HashBits, U, typename Collection::MetadataCursor
+        >;
     using MD = typename Backend::Metadata;
 
     constexpr static inline auto RequestedSize = RequestedSize_;
@@ -332,83 +482,81 @@ struct RH_Frontend_WithSkarupkeTail {
     constexpr static inline auto HighestSafePSL =
         LongestEncodablePSL - MD::NSlots - 1;
 
-    using MetadataCollection = std::array<MD, SWARCount>;
+    static_assert(SWARCount == Collection::SWARCount);
+    /// Whether writes may throw, as in storages that allocate on write
+    constexpr static inline bool NoexceptWrites =
+        noexcept(std::declval<Collection &>().writableSlot(0));
+
     using value_type = std::pair<K, MV>;
 
-    MetadataCollection md_;
     /// \todo Scatter key and value in a flavor
-    std::array<KeyValuePairWrapper<K, MV>, SlotCount> values_;
     size_t elementCount_;
 
-    RH_Frontend_WithSkarupkeTail() noexcept: elementCount_(0) {
-        for(auto &mde: md_) { mde = MD{0}; }
-    }
+    RH_Frontend_WithSkarupkeTail()
+        noexcept(std::is_nothrow_default_constructible_v<Collection>):
+        elementCount_(0)
+    {}
 
-    template<typename Callable>
-    void traverse(Callable &&c) const {
-        for(size_t swarIndex = 0; swarIndex < SWARCount; ++swarIndex) {
-            auto PSLs = md_[swarIndex].PSLs();
-            auto occupied = booleans(PSLs);
-            while(occupied) {
-                auto intraIndex = occupied.lsbIndex();
-                c(swarIndex, intraIndex);
-                occupied = occupied.clearLSB();
-            }
-        }
-    }
-
-    ~RH_Frontend_WithSkarupkeTail() {
-        traverse([thy=this](std::size_t sI, std::size_t intra) {
-            thy->values_[intra + sI * MD::NSlots].destroy();
-        });
-    }
+    RH_Frontend_WithSkarupkeTail(const RH_Frontend_WithSkarupkeTail &) = default;
 
-    RH_Frontend_WithSkarupkeTail(const RH_Frontend_WithSkarupkeTail &model):
-        RH_Frontend_WithSkarupkeTail()
+    /// The donor is left empty
+    RH_Frontend_WithSkarupkeTail(RH_Frontend_WithSkarupkeTail &&donor)
+        noexcept(std::is_nothrow_move_constructible_v<Collection>):
+        Collection(std::move(donor)),
+        elementCount_(donor.elementCount_)
     {
-        model.traverse([thy=this,other=&model](std::size_t sI, std::size_t intra) {
-            auto index = intra + sI * MD::NSlots;
-            thy->values_[index].build(other->values_[index].value());
-            thy->md_[sI] = thy->md_[sI].blitElement(other->md_[sI], intra);
-            ++thy->elementCount_;
-        });
+        donor.elementCount_ = 0;
     }
 
-    RH_Frontend_WithSkarupkeTail(RH_Frontend_WithSkarupkeTail &&donor) noexcept:
-        md_(donor.md_), elementCount_(donor.elementCount_)
-    {
-        traverse([thy=this, other=&donor](std::size_t sI, std::size_t intra) {
-            auto index = intra + sI * MD::NSlots;
-            thy->values_[index].build(std::move(other->values_[index].value()));
-        });
-    }
 
+    using HashedKey = rh::HashedKey<K, U, Hash, Scatter, HashReduce>;
 
-    auto findParameters(const K &k) const noexcept {
-        auto [hoisted, homeIndex] =
-            findBasicParameters<
-                K, RequestedSize, HashBits, U,
-                Hash, Scatter, RangeReduce, HashReduce
-            >(k);
+    /// \brief Hashes the key once, to then find or insert it in any number
+    /// of tables with the same hashing policies
+    static HashedKey hashed(const K &k) noexcept {
+        return hashKey<K, HashBits, U, Hash, Scatter, HashReduce>(k);
+    }
+
+    auto findParameters(const HashedKey &hk) const noexcept {
+        auto homeIndex = RangeReduce{}(hk.scattered_);
         return
             std::tuple{
-                hoisted,
+                hk.hoisted_,
                 homeIndex,
-                [thy = this, &k](size_t ndx) noexcept {
-                    return KE{}(thy->values_[ndx].value().first, k);
+                [thy = this, k = hk.key_](size_t ndx) noexcept {
+                    return KE{}(thy->slot(ndx).value().first, *k);
                 }
             };
     }
 
+    auto findParameters(const K &k) const noexcept {
+        return findParameters(hashed(k));
+    }
+
     template<typename ValuteTypeCompatible>
     auto insert(ValuteTypeCompatible &&val) {
-        auto &k = val.first;
-        auto &mv = val.second;
-        auto [hoistedT, homeIndexT, kc] = findParameters(k);
-        auto hoisted = hoistedT;
-        auto homeIndex = homeIndexT;
-        auto thy = const_cast<RH_Frontend_WithSkarupkeTail *>(this);
-        Backend be{thy->md_.data()};
+        return insert(hashed(val.first), std::forward<ValuteTypeCompatible>(val));
+    }
+
+    /// \pre \c hk is the hashing of the key in \c val
+    template<typename ValuteTypeCompatible>
+    auto insert(const HashedKey &hk, ValuteTypeCompatible &&val) {
+        auto [hoisted, homeIndex, kc] = findParameters(hk);
+        return
+            insertKnowingParameters(
+                hoisted, homeIndex, kc,
+                std::forward<ValuteTypeCompatible>(val)
+            );
+    }
+
+    /// \brief Insertion for when the hoisted hash and the home index have
+    /// already been calculated
+    template<typename KeyChecker, typename ValuteTypeCompatible>
+    auto insertKnowingParameters(
+        U hoisted, std::size_t homeIndex, const KeyChecker &kc,
+        ValuteTypeCompatible &&val
+    ) {
+        Backend be{this->metadataCursor()};
         auto [iT, deadlineT, needleT] =
             be.findMisaligned_assumesSkarupkeTail(hoisted, homeIndex, kc);
         auto index = iT;
@@ -416,7 +564,14 @@ struct RH_Frontend_WithSkarupkeTail {
             throw MaximumProbeSequenceLengthExceeded("Scanning for eviction, from finding");
         }
         auto deadline = deadlineT;
-        if(!deadline) { return std::pair{iterator(values_.data() + index), false}; }
+        if(!deadline) {
+            // the value present is not written unless through the iterator
+            if constexpr(Collection::ContiguousSlots) {
+                return std::pair{iterator(&this->writableSlot(index)), false};
+            } else {
+                return std::pair{iterator(this, index), false};
+            }
+        }
         auto needle = needleT;
         auto rv =
             insertionEvictionChain(
@@ -427,6 +582,309 @@ struct RH_Frontend_WithSkarupkeTail {
         return rv;
     }
 
+    /// \brief The combiner of \c merge, the keys present in both tables keep
+    /// the mapped value of this table, which is not written
+    struct KeepMine {
+        void operator()(MV &, const MV &) const noexcept {}
+    };
+
+    /// \brief Inserts the elements of \c other whose keys are not present,
+    /// the keys present in both keep the mapped value in this table.
+    void merge(const RH_Frontend_WithSkarupkeTail &other) {
+        merge_with(other, KeepMine{});
+    }
+
+    /*! \brief Inserts the elements of \c other, calling
+    <tt>combiner(mine, theirs)</tt> for the mapped values of keys already
+    present.
+
+    Naive reinsertion would rehash every key and probe from scattered home
+    indices.  Since both tables have the same hashing policies and size, the
+    hoisted hash and the home index of each element of \c other are recovered
+    from its metadata: the home index is the slot index minus the PSL (less
+    one).  Furthermore, the Robin Hood invariant guarantees the PSL grows at
+    most by one from one slot to the next, hence traversing \c other in slot
+    order visits its elements grouped by, and in non-decreasing order of, home
+    index: the searches and metadata updates in this table progress
+    sequentially through memory.
+
+    Merging a table with itself only combines each mapped value with a copy of
+    itself, since the insertions would traverse the table being modified.
+    With \c KeepMine as the combiner the slots of the keys present are not
+    made writable.
+
+    Provides the basic exception safety guarantee: if an insertion throws,
+    the elements merged up to that point remain.
+    */
+    template<typename Combiner>
+    void merge_with(const RH_Frontend_WithSkarupkeTail &other, Combiner &&combiner) {
+        constexpr auto Combines = !std::is_same_v<KeepMine, std::decay_t<Combiner>>;
+        if(this == &other) {
+            if constexpr(!Combines) { return; }
+            this->traverse([thy = this, &combiner](std::size_t sI, std::size_t intra) {
+                auto &mine = thy->writableSlot(intra + sI * MD::NSlots).value();
+                const MV theirs = mine.second;
+                combiner(mine.second, theirs);
+            });
+            return;
+        }
+        other.traverse([&](std::size_t sI, std::size_t intra) {
+            auto index = intra + sI * MD::NSlots;
+            auto md = other.metadata(sI);
+            auto psl = md.leastFlat(intra);
+            auto hoisted = md.mostFlat(intra);
+            auto homeIndex = index - psl + 1;
+            auto &theirs = other.slot(index).value();
+            auto [where, inserted] =
+                insertKnowingParameters(
+                    hoisted, homeIndex,
+                    [thy = this, &theirs](std::size_t ndx) noexcept {
+                        return KE{}(thy->slot(ndx).value().first, theirs.first);
+                    },
+                    theirs
+                );
+            if constexpr(Combines) {
+                if(!inserted) { combiner(where->second, theirs.second); }
+            }
+        });
+    }
+
+    /*! \brief Erases the elements for which \c pred is true, returns how
+    many were erased
+
+    Erasing elements one by one would backward-shift the rest of the cluster
+    after each erasure.  Instead, a single left-to-right sweep of the metadata
+    marks the victims of each SWAR and compacts the clusters: an element moves
+    back over the holes accumulated before it, but never before its home, so
+    the elements stay in home index order and the Robin Hood invariant is
+    kept.  If \c gap holes precede an element of PSL \c p, it moves
+    <tt>m = min(gap, p - 1)</tt> slots, and leaves \c m holes for the next.
+    The moves of a SWAR are assembled as a SWAR to rewrite all of its PSLs
+    with one subtraction; SWARs without victims nor pending holes are
+    skipped.
+    The cost is O(SlotCount) regardless of the number of victims.
+
+    \pre \c pred does not throw
+    */
+    template<typename Predicate>
+    std::size_t erase_if(Predicate &&pred) {
+        std::size_t erased = 0, gap = 0;
+        for(std::size_t sI = 0; sI < SWARCount; ++sI) {
+            auto input = this->metadata(sI);
+            auto PSLs = input.PSLs();
+            auto base = sI * MD::NSlots;
+            U victims = 0;
+            for(auto occupied = booleans(PSLs); occupied; occupied = occupied.clearLSB()) {
+                auto intra = occupied.lsbIndex();
+                if(pred(this->slot(base + intra).value())) {
+                    victims |= U(1) << (intra * MD::NBits);
+                }
+            }
+            if(!victims && !gap) { continue; }
+            U moves = 0;
+            for(std::size_t intra = 0; intra < MD::NSlots; ++intra) {
+                auto psl = PSLs.at(intra);
+                if(!psl) { gap = 0; continue; }
+                if(victims & (U(1) << (intra * MD::NBits))) {
+                    ++gap;
+                    continue;
+                }
+                auto move = gap < psl - 1 ? gap : psl - 1;
+                moves |= U(move) << (intra * MD::NBits);
+                gap = move;
+            }
+            // Storages that allocate on write do it before any change
+            this->writableSlot(base);
+            for(auto m = booleans(MD{moves}); m; m = m.clearLSB()) {
+                auto intra = m.lsbIndex();
+                this->writableSlot(base + intra - MD{moves}.at(intra));
+            }
+            for(
+                auto dying = booleans(MD{victims << (MD::NBits - 1)});
+                dying;
+                dying = dying.clearLSB()
+            ) {
+                this->writableSlot(base + dying.lsbIndex()).destroy();
+                ++erased;
+            }
+            auto newPSLs = PSLs - MD{moves};
+            auto relocated = MD{input.hashes() | newPSLs};
+            // victim lanes and the lanes of moving elements become empty
+            constexpr auto LaneOnes = (U(1) << MD::NBits) - 1;
+            auto leaving =
+                booleans(MD{moves}).MSBtoLaneMask().value() |
+                victims * LaneOnes;
+            this->setMetadata(sI, MD{input.value() & ~leaving});
+            for(
+                auto moving = booleans(MD{moves});
+                moving;
+                moving = moving.clearLSB()
+            ) {
+                auto intra = moving.lsbIndex();
+                auto from = base + intra;
+                auto to = from - MD{moves}.at(intra);
+                auto &source = this->writableSlot(from);
+                this->writableSlot(to).build(std::move(source.value()));
+                source.destroy();
+                auto toSWAR = to / MD::NSlots;
+                this->setMetadata(
+                    toSWAR,
+                    this->metadata(toSWAR).blitElement(
+                        to % MD::NSlots, relocated.at(intra)
+                    )
+                );
+            }
+        }
+        elementCount_ -= erased;
+        return erased;
+    }
+
+    /// \brief Erases the element with the key \c k, returns the number of
+    /// elements erased
+    std::size_t erase(const K &k) { return erase(hashed(k)); }
+
+    std::size_t erase(const HashedKey &hk) {
+        auto [hoisted, homeIndex, kc] = findParameters(hk);
+        auto [index, found] = findIndexKnowingParameters(hoisted, homeIndex, kc);
+        if(!found) { return 0; }
+        eraseAt(index);
+        return 1;
+    }
+
+    /*! \brief Erases the element at \c index by backward shifting
+
+    The elements after the erased one, up to the first empty or at home slot,
+    the end of the cluster, must move back one slot.  But the elements with
+    the same home index are interchangeable, so, each run of them is
+    "rotated": only the last element of the run moves, to the hole in front
+    of the run, and leaves the new hole for the next run.  The PSLs of the
+    rest of the run do not change.  The runs are detected with
+    <tt>impl::Metadata::sameHomeAsPrevious</tt>, a SWAR at a time, hence the
+    element moves and metadata updates are one per run, not one per element.
+
+    Most clusters are short, hence their first elements move one by one,
+    cheaper than the detection of the runs; only the rest of a long cluster
+    is rotated.  Storages whose writes may throw do not move one by one, to
+    allocate before any change.  Trivially relocatable elements, see
+    \c meta::is_trivially_relocatable, are cheaper to move than the runs to
+    detect: the rest of their cluster is shifted back plainly, with its
+    metadata a SWAR at a time.
+    */
+    void eraseAt(std::size_t index) {
+        constexpr auto LaneBits = MD::NBits;
+        constexpr auto Bitwise = meta::is_trivially_relocatable_v<value_type>;
+        auto pslAt = [thy = this](std::size_t i) {
+            return thy->metadata(i / MD::NSlots).PSLs().at(i % MD::NSlots);
+        };
+        auto lanesFrom = [](std::size_t intra) {
+            return intra < MD::NSlots ? ~U(0) << (intra * LaneBits) : U(0);
+        };
+        auto blit = [thy = this](std::size_t i, U e) {
+            auto sI = i / MD::NSlots;
+            thy->setMetadata(sI, thy->metadata(sI).blitElement(i % MD::NSlots, e));
+        };
+        auto relocate = [thy = this](std::size_t to, std::size_t from) {
+            auto &source = thy->writableSlot(from);
+            if constexpr(Bitwise) {
+                memcpy(
+                    static_cast<void *>(&thy->writableSlot(to)), &source,
+                    sizeof(KeyValuePairWrapper<K, MV>)
+                );
+            } else {
+                thy->writableSlot(to).build(std::move(source.value()));
+                source.destroy();
+            }
+        };
+        auto hole = index;
+        if constexpr(NoexceptWrites) {
+            this->writableSlot(index).destroy();
+            --elementCount_;
+            for(auto moves = MD::NSlots; moves--; ) {
+                auto next = hole + 1;
+                auto psl = pslAt(next);
+                if(psl < 2) {
+                    blit(hole, 0);
+                    return;
+                }
+                relocate(hole, next);
+                auto hash =
+                    this->metadata(next / MD::NSlots).hashes().at(next % MD::NSlots);
+                blit(hole, hash | (psl - 1));
+                hole = next;
+            }
+        }
+        auto first = hole + 1;
+        auto clusterEnd = [&]() {
+            constexpr auto Twos = broadcast(MD{2});
+            for(auto i = first; ; i = (i / MD::NSlots + 1) * MD::NSlots) {
+                auto psls = this->metadata(i / MD::NSlots).PSLs();
+                auto atHomeOrEmpty =
+                    (~greaterEqual_MSB_off(psls, Twos)).value() &
+                    lanesFrom(i % MD::NSlots);
+                if(atHomeOrEmpty) {
+                    return
+                        i / MD::NSlots * MD::NSlots +
+                        swar::lsbIndex(atHomeOrEmpty) / LaneBits;
+                }
+            }
+        }();
+        auto firstSWAR = first / MD::NSlots, lastSWAR = clusterEnd / MD::NSlots;
+        if constexpr(!NoexceptWrites) {
+            // Storages that allocate on write do it before any change
+            for(auto sI = index / MD::NSlots; sI <= lastSWAR; ++sI) {
+                this->writableSlot(sI * MD::NSlots);
+            }
+            this->writableSlot(index).destroy();
+            --elementCount_;
+        }
+        if constexpr(Bitwise) {
+            for(auto i = first; i < clusterEnd; ++i) { relocate(i - 1, i); }
+            // The slot before each of the cluster takes its metadata with
+            // one less PSL, the last slot of the cluster becomes empty
+            constexpr auto Ones = broadcast(MD{1}).value();
+            for(auto sI = hole / MD::NSlots; sI <= (clusterEnd - 1) / MD::NSlots; ++sI) {
+                auto base = sI * MD::NSlots;
+                auto md = this->metadata(sI).value();
+                auto next = sI + 1 < SWARCount ? this->metadata(sI + 1).value() : U(0);
+                auto shifted =
+                    (md >> LaneBits) | (next << (LaneBits * (MD::NSlots - 1)));
+                auto from = hole < base ? 0 : hole - base;
+                auto vacated = clusterEnd - 1 - base;
+                auto moving = lanesFrom(from) & ~lanesFrom(vacated) & MD::AllOnes;
+                auto changing = lanesFrom(from) & ~lanesFrom(vacated + 1);
+                this->setMetadata(
+                    sI, MD{(md & ~changing) | ((shifted & moving) - (Ones & moving))}
+                );
+            }
+            return;
+        }
+        // The run that starts at runStart ends before the next start, then
+        // its last element moves to the hole, and leaves the next hole.
+        // The lanes of a SWAR are rewritten only after the starts of the
+        // runs in it are calculated.
+        auto runStart = first;
+        for(auto sI = firstSWAR; sI <= lastSWAR; ++sI) {
+            auto previousPSL = sI ? pslAt(sI * MD::NSlots - 1) : 0;
+            auto starts =
+                (~this->metadata(sI).sameHomeAsPrevious(previousPSL)).value();
+            if(sI == firstSWAR) { starts &= lanesFrom(first % MD::NSlots + 1); }
+            if(sI == lastSWAR) {
+                starts &= ~lanesFrom(clusterEnd % MD::NSlots + 1);
+            }
+            for(; starts; starts = swar::clearLSB(starts)) {
+                auto start = sI * MD::NSlots + swar::lsbIndex(starts) / LaneBits;
+                auto last = start - 1;
+                relocate(hole, last);
+                auto hash =
+                    this->metadata(last / MD::NSlots).hashes().at(last % MD::NSlots);
+                blit(hole, hash | (pslAt(runStart) - 1));
+                hole = last;
+                runStart = start;
+            }
+        }
+        blit(hole, 0);
+    }
+
     // Do the chain of relocations
     // From this point onward, the hashes don't matter except for the
     // updates to the metadata, the relocations
@@ -441,7 +899,6 @@ struct RH_Frontend_WithSkarupkeTail {
         auto &mv = val.second;
         auto swarIndex = index / MD::Lanes;
         auto intraIndex = index % MD::Lanes;
-        auto mdp = this->md_.data() + swarIndex;
 
         // Because we have not decided about strong versus basic exception
         // safety guarantee, for the time being we will just put a very large
@@ -460,33 +917,37 @@ struct RH_Frontend_WithSkarupkeTail {
         for(;;) {
             // Loop invariant:
             // deadline, index, swarIndex, intraIndex, elementToInsert correct
-            // mdp points to the haystack that gave the deadline
-            auto md = *mdp;
+            // swarIndex is the haystack that gave the deadline
+            auto md = this->metadata(swarIndex);
             auto evictedPSL = md.PSLs().at(intraIndex);
             if(0 == evictedPSL) { // end of eviction chain!
                 if(SlotCount - 1 <= index) {
                     throw MaximumProbeSequenceLengthExceeded("full table");
                 }
+                auto blit = [thy = this](std::size_t sI, std::size_t intra, U e) {
+                    thy->setMetadata(sI, thy->metadata(sI).blitElement(intra, e));
+                };
                 if(0 == relocationsCount) { // direct build of a new value
-                    values_[index].build(
+                    this->writableSlot(index).build(
                         std::piecewise_construct,
                         std::tuple(std::forward<VTC>(val).first),
                         std::tuple(std::forward<VTC>(val).second)
                     );
-                    *mdp = mdp->blitElement(intraIndex, elementToInsert);
-                    return std::pair{iterator(values_.data() + index), true};
+                    blit(swarIndex, intraIndex, elementToInsert);
+                    return std::pair{iterator(&this->writableSlot(index)), true};
+                }
+                // Storages that allocate on write do it before any change
+                for(auto r = relocationsCount; r--; ) {
+                    this->writableSlot(relocations[r]);
                 }
                 // the last element is special because it is a
                 // move-construction, not a move-assignment
                 --relocationsCount;
                 auto fromIndex = relocations[relocationsCount];
-                values_[index].build(
-                    std::move(values_[fromIndex].value())
+                this->writableSlot(index).build(
+                    std::move(this->writableSlot(fromIndex).value())
                 );
-                md_[swarIndex] =
-                    md_[swarIndex].blitElement(
-                        intraIndex, elementToInsert
-                    );
+                blit(swarIndex, intraIndex, elementToInsert);
                 elementToInsert = newElements[relocationsCount];
                 index = fromIndex;
                 swarIndex = index / MD::NSlots;
@@ -494,24 +955,27 @@ struct RH_Frontend_WithSkarupkeTail {
                 // do the pair relocations
                 while(relocationsCount--) {
                     fromIndex = relocations[relocationsCount];
-                    values_[index].value() =
-                        std::move(values_[fromIndex].value());
-                    md_[swarIndex] =
-                        md_[swarIndex].blitElement(intraIndex, elementToInsert);
+                    this->writableSlot(index).value() =
+                        std::move(this->writableSlot(fromIndex).value());
+                    blit(swarIndex, intraIndex, elementToInsert);
                     elementToInsert = newElements[relocationsCount];
                     index = fromIndex;
                     swarIndex = index / MD::NSlots;
                     intraIndex = index % MD::NSlots;
                 }
-                values_[index].value() = std::forward<VTC>(val);
-                md_[swarIndex] =
-                    md_[swarIndex].blitElement(intraIndex, elementToInsert);
-                return std::pair{iterator(values_.data() + index), true};
+                this->writableSlot(index).value() = std::forward<VTC>(val);
+                blit(swarIndex, intraIndex, elementToInsert);
+                return std::pair{iterator(&this->writableSlot(index)), true};
             }
             if(HighestSafePSL < evictedPSL) {
                 throw MaximumProbeSequenceLengthExceeded("Encoding insertion");
             }
             
+            // The elements of the same home are interchangeable, the search
+            // for the place of the evicted element skips the whole run of
+            // its home (their PSLs are the progression of the needle), so
+            // that the chain moves only one element per run, a "rotation".
+
             // evict the "deadline" element:
             // first, insert the element in its place (it "stole")
             // find the place for the evicted: when Robin Hood breaks again.
@@ -594,11 +1058,8 @@ struct RH_Frontend_WithSkarupkeTail {
                 needlePSLs = needlePSLs + lowerPart + topAdd;
                 for(;;) { // hunt for the next deadline
                     ++swarIndex;
-                        // should the maintenance of `index` be replaced
-                        // with pointer arithmetic on mdp?
                     index += MD::NSlots;
-                    ++mdp;
-                    haystackPSLs = mdp->PSLs();
+                    haystackPSLs = this->metadata(swarIndex).PSLs();
                     breaksRobinHood =
                         ~greaterEqual_MSB_off(haystackPSLs, needlePSLs);
                     if(breaksRobinHood) { break; }
@@ -629,32 +1090,98 @@ struct RH_Frontend_WithSkarupkeTail {
         }
 
         bool operator!=(const const_iterator &other) const noexcept {
-            return p_ == other.p_;
+            return p_ != other.p_;
         }
 
         const_iterator(const KeyValuePairWrapper<K, MV> *p): p_(p) {}
         const_iterator(const const_iterator &) = default;
     };
 
+    /// For storages without contiguous slots, the slot is resolved for
+    /// writing, which may copy its page, on the first access through the
+    /// iterator; read through a \c const_iterator to keep sharing it
     struct iterator: const_iterator {
-        value_type *ncp() { return const_cast<value_type *>(&this->p_->value()); }
-        value_type &operator*() noexcept { return *ncp(); }
-        value_type *operator->() noexcept { return ncp(); }
+        RH_Frontend_WithSkarupkeTail *owner_ = nullptr;
+        std::size_t index_ = 0;
+
+        value_type *ncp() noexcept(NoexceptWrites) {
+            if(owner_) {
+                this->p_ = &owner_->writableSlot(index_);
+                owner_ = nullptr;
+            }
+            return const_cast<value_type *>(&this->p_->value());
+        }
+        value_type &operator*() noexcept(NoexceptWrites) { return *ncp(); }
+        value_type *operator->() noexcept(NoexceptWrites) { return ncp(); }
         using const_iterator::const_iterator;
+
+        iterator(RH_Frontend_WithSkarupkeTail *owner, std::size_t index) noexcept:
+            const_iterator(&owner->slot(index)), owner_(owner), index_(index)
+        {}
     };
 
-    const_iterator begin() const noexcept { return this->values_.data(); }
-    const_iterator end() const noexcept {
-        return this->values_.data() + this->values_.size();
+    const_iterator begin() const noexcept { return &this->slot(0); }
+    /// \brief The result of the searches that fail
+    ///
+    /// Not the position after the last slot, the slots may not be
+    /// contiguous, see \c displacement
+    const_iterator end() const noexcept { return nullptr; }
+
+    inline iterator find(const HashedKey &hk)
+        noexcept(NoexceptWrites) __attribute__((always_inline));
+
+    /// \brief The index of the slot of the key, and whether it was found
+    template<typename KeyChecker>
+    std::tuple<std::size_t, bool> findIndexKnowingParameters(
+        U hoisted, std::size_t homeIndex, const KeyChecker &kc
+    ) const noexcept {
+        Backend be{this->metadataCursor()};
+        auto [index, deadline, dontcare] =
+            be.findMisaligned_assumesSkarupkeTail(hoisted, homeIndex, kc);
+        return {index, !deadline};
+    }
+
+    /// \brief Search for when the hoisted hash and the home index have
+    /// already been calculated, with an arbitrary key checker
+    template<typename KeyChecker>
+    iterator findKnowingParameters(
+        U hoisted, std::size_t homeIndex, const KeyChecker &kc
+    ) noexcept(NoexceptWrites) {
+        auto [index, found] = findIndexKnowingParameters(hoisted, homeIndex, kc);
+        if(!found) { return iterator(nullptr); }
+        if constexpr(Collection::ContiguousSlots) {
+            return iterator(&this->writableSlot(index));
+        } else {
+            return iterator(this, index);
+        }
+    }
+
+    template<typename KeyChecker>
+    const_iterator findKnowingParameters(
+        U hoisted, std::size_t homeIndex, const KeyChecker &kc
+    ) const noexcept {
+        auto [index, found] = findIndexKnowingParameters(hoisted, homeIndex, kc);
+        return found ? const_iterator(&this->slot(index)) : end();
     }
 
-    inline iterator find(const K &k) noexcept __attribute__((always_inline));
+    iterator find(const K &k) noexcept(NoexceptWrites) {
+        return find(hashed(k));
+    }
 
-    const_iterator find(const K &k) const noexcept {
-        const_cast<RH_Frontend_WithSkarupkeTail *>(this)->find(k);
+    const_iterator find(const HashedKey &hk) const noexcept {
+        auto [hoisted, homeIndex, keyChecker] = findParameters(hk);
+        return findKnowingParameters(hoisted, homeIndex, keyChecker);
     }
 
+    const_iterator find(const K &k) const noexcept { return find(hashed(k)); }
+
+    /// \pre the slots are contiguous, the addresses of slots in different
+    /// pages are not comparable
     auto displacement(const_iterator from, const_iterator to) {
+        static_assert(
+            Collection::ContiguousSlots,
+            "The distance between slots requires contiguous slots"
+        );
         return to.p_ - from.p_;
     }
 };
@@ -669,23 +1196,111 @@ template<
     typename U,
     typename Scatter,
     typename RangeReduce,
-    typename HashReduce
+    typename HashReduce,
+    typename Storage
 >
 auto
 RH_Frontend_WithSkarupkeTail<
     K, MV, RequestedSize_, PSL_Bits, HashBits, Hash, KE, U, Scatter,
-    RangeReduce, HashReduce
->::find(const K &k) noexcept -> iterator
+    RangeReduce, HashReduce, Storage
+>::find(const HashedKey &hk) noexcept(NoexceptWrites) -> iterator
 {
-        auto [hoisted, homeIndex, keyChecker] = findParameters(k);
-        Backend be{this->md_.data()};
-        auto [index, deadline, dontcare] =
-            be.findMisaligned_assumesSkarupkeTail(
-                hoisted, homeIndex, keyChecker
-            );
-        return deadline ? values_.end() : values_.data() + index;
+        auto [hoisted, homeIndex, keyChecker] = findParameters(hk);
+        return findKnowingParameters(hoisted, homeIndex, keyChecker);
     }
 
+/// \brief Relative cost of a deep key comparison, in units of the cost of
+/// reading a metadata SWAR
+///
+/// Keys that are not arithmetic nor pointers are assumed to be indirect, such
+/// as strings.  Specialize for other key types.
+template<typename K>
+struct DeepComparisonCost {
+    constexpr static inline int value =
+        (std::is_arithmetic_v<K> || std::is_pointer_v<K>) ? 1 : 8;
+};
+
+/*! \brief Chooses the metadata lane width (8 or 16 bits) and the split of the
+lane into PSL and hoisted hash bits for a table of \c RequestedSize slots to
+be filled up to \c LoadPercent
+
+The PSL bits must encode the maximum PSL plus the slots of one SWAR (see
+\c HighestSafePSL), otherwise insertions fail with
+\c MaximumProbeSequenceLengthExceeded.  Simulations of Robin Hood insertion of
+random keys, from 2^11 to 2^24 slots and loads from 50 to 95%, give maximum
+PSLs below <tt>0.35 * log2(RequestedSize) / (1 - load)</tt>; the model uses
+0.5 as the coefficient for margin.
+
+The remaining bits of the lane are for the hoisted hash.  For each lane width,
+the expected cost of a lookup is estimated as the metadata SWARs read, one
+plus the expected probe length over the slots per SWAR, plus the expected
+number of deep comparisons of false positives of \c potentialMatches, the
+load factor (the mean number of keys with the same home) times the
+probability of the hoisted hashes coinciding, 2^-HashBits, weighted by
+\c DeepComparisonCost.  The cheapest feasible lane width is chosen, the
+narrower one if equal.
+*/
+template<std::size_t RequestedSize, int LoadPercent, typename K = int>
+struct AutoTunedConfiguration {
+    static_assert(0 < LoadPercent && LoadPercent < 100);
+
+    constexpr static inline int ExpectedMaximumPSL =
+        (meta::logCeiling(RequestedSize) * 100 + 2 * (100 - LoadPercent) - 1) /
+        (2 * (100 - LoadPercent));
+
+    struct Candidate {
+        int laneBits, pslBits, hashBits;
+        bool feasible;
+        long cost; // in 1/65536 of a metadata SWAR read
+
+        constexpr Candidate(int lb):
+            laneBits(lb),
+            pslBits(meta::logCeiling(ExpectedMaximumPSL + 64 / lb + 1)),
+            hashBits(lb - pslBits),
+            feasible(0 < hashBits),
+            cost(0)
+        {
+            constexpr long Unit = 1 << 16;
+            auto slotsPerSWAR = 64 / lb;
+            // the expected probe length is in the order of 1 / (1 - load)
+            auto swarReads =
+                Unit + Unit * 100 / (100 - LoadPercent) / slotsPerSWAR;
+            auto falsePositives =
+                feasible && hashBits < 16 ?
+                    Unit * LoadPercent / 100 / (1l << hashBits) :
+                    0;
+            cost = swarReads + falsePositives * DeepComparisonCost<K>::value;
+        }
+    };
+
+    constexpr static inline Candidate
+        Narrow{8},
+        Wide{16},
+        Chosen = (Narrow.feasible && Narrow.cost <= Wide.cost) ? Narrow : Wide;
+
+    static_assert(Chosen.feasible, "Requested load too high for 16-bit lanes");
+
+    constexpr static inline int
+        LaneBits = Chosen.laneBits,
+        PSL_Bits = Chosen.pslBits,
+        HashBits = Chosen.hashBits;
+};
+
+/// \brief Frontend with the metadata configuration chosen by
+/// \c AutoTunedConfiguration
+template<
+    typename K, typename MV, std::size_t RequestedSize, int LoadPercent,
+    typename Hash = std::hash<K>,
+    typename KE = std::equal_to<K>
+>
+using RH_Frontend_AutoTuned =
+    RH_Frontend_WithSkarupkeTail<
+        K, MV, RequestedSize,
+        AutoTunedConfiguration<RequestedSize, LoadPercent, K>::PSL_Bits,
+        AutoTunedConfiguration<RequestedSize, LoadPercent, K>::HashBits,
+        Hash, KE
+    >;
+
 } // rh
 
 } // swar, zoo
@@ -0,0 +1,212 @@
+#ifndef ZOO_MAP_ROBINHOOD_COPY_ON_WRITE_H
+#define ZOO_MAP_ROBINHOOD_COPY_ON_WRITE_H
+
+#include "zoo/map/RobinHood.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+/*! \file RobinHoodCopyOnWrite.h
+\brief Robin Hood tables whose copies, "snapshots", share the storage
+
+The metadata and the slots are split in pages of \c PageSlots slots, each page
+holding both the metadata and the slots of its range.  The table holds shared
+pointers to the pages: copying a table copies only the pointers, and a write
+copies the page it touches if it is shared.  Hence the cost of a snapshot of a
+large table is one pointer per page, and afterwards the writer pays for the
+pages it modifies, once each.
+
+Concurrency: a single writer may modify the table while other threads read
+snapshots of it; a snapshot is never modified, so, it may be shared by any
+number of readers.  The writer must take the snapshots itself, since a write
+checks whether a page is shared by its reference count.
+*/
+
+namespace zoo {
+namespace rh {
+
+/// \brief Storage policy of the frontend in copy-on-write pages, see
+/// \c ArrayStorage
+template<std::size_t PageSlots = 512>
+struct CopyOnWritePages {
+    template<typename MD, typename Slot, std::size_t MinimumSlots>
+    struct Collection {
+        static_assert(0 == PageSlots % MD::NSlots);
+
+        constexpr static inline std::size_t
+            SWARCount = (MinimumSlots + MD::NSlots - 1) / MD::NSlots,
+            SlotCount = SWARCount * MD::NSlots,
+            PageSWARs = PageSlots / MD::NSlots,
+            PageCount = (SWARCount + PageSWARs - 1) / PageSWARs;
+        constexpr static inline bool ContiguousSlots = false;
+
+        /// Owns the elements in its slots, as indicated by its metadata
+        struct Page {
+            std::array<MD, PageSWARs> md_;
+            std::array<Slot, PageSlots> values_;
+
+            template<typename Callable>
+            void traverse(Callable &&c) const {
+                impl::traverseOccupied(
+                    PageSWARs,
+                    [thy = this](std::size_t sI) { return thy->md_[sI]; },
+                    std::forward<Callable>(c)
+                );
+            }
+
+            Page() noexcept {
+                for(auto &mde: md_) { mde = MD{0}; }
+            }
+
+            Page(const Page &model): Page() {
+                if constexpr(
+                    std::is_trivially_copy_constructible_v<typename Slot::type>
+                ) {
+                    memcpy(
+                        static_cast<void *>(values_.data()), model.values_.data(),
+                        sizeof(values_)
+                    );
+                    md_ = model.md_;
+                    return;
+                }
+                model.traverse([thy = this, other = &model](std::size_t sI, std::size_t intra) {
+                    auto index = intra + sI * MD::NSlots;
+                    thy->values_[index].build(other->values_[index].value());
+                    thy->md_[sI] =
+                        thy->md_[sI].blitElement(intra, other->md_[sI].at(intra));
+                });
+            }
+
+            ~Page() {
+                traverse([thy = this](std::size_t sI, std::size_t intra) {
+                    thy->values_[intra + sI * MD::NSlots].destroy();
+                });
+            }
+        };
+
+        /// Reads the metadata across pages as if it were contiguous
+        struct MetadataCursor {
+            const Collection *collection_;
+            std::size_t swarIndex_;
+
+            MD operator[](std::size_t offset) const noexcept {
+                return collection_->metadata(swarIndex_ + offset);
+            }
+            MD operator*() const noexcept { return (*this)[0]; }
+            MetadataCursor &operator++() noexcept {
+                ++swarIndex_;
+                return *this;
+            }
+            MetadataCursor operator+(std::size_t offset) const noexcept {
+                return {collection_, swarIndex_ + offset};
+            }
+        };
+
+        std::array<std::shared_ptr<Page>, PageCount> pages_;
+
+        /// Shared by all the tables of this type
+        static const std::shared_ptr<Page> &emptyPage() {
+            static const auto rv = std::make_shared<Page>();
+            return rv;
+        }
+
+        /// All pages start as the empty page
+        Collection() {
+            for(auto &page: pages_) { page = emptyPage(); }
+        }
+
+        Collection(const Collection &) = default;
+
+        /// The pages are moved, the donor is left with the empty page
+        Collection(Collection &&donor) noexcept {
+            // the empty page exists already, the donor was constructed
+            auto &empty = emptyPage();
+            for(std::size_t ndx = 0; ndx < PageCount; ++ndx) {
+                pages_[ndx] = std::move(donor.pages_[ndx]);
+                donor.pages_[ndx] = empty;
+            }
+        }
+
+        template<typename Callable>
+        void traverse(Callable &&c) const {
+            impl::traverseOccupied(
+                SWARCount,
+                [thy = this](std::size_t sI) { return thy->metadata(sI); },
+                std::forward<Callable>(c)
+            );
+        }
+
+        /// Copies the page if shared
+        Page &writablePage(std::size_t pageIndex) {
+            auto &page = pages_[pageIndex];
+            if(1 < page.use_count()) {
+                page = std::make_shared<Page>(*page);
+            } else {
+                // use_count() is a relaxed load: the fence makes the reads
+                // of a reader that released the last snapshot of the page
+                // happen before the writes that follow, the release of the
+                // reference count synchronizes with it
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            return *page;
+        }
+
+        MetadataCursor metadataCursor() const noexcept { return {this, 0}; }
+
+        MD metadata(std::size_t swarIndex) const noexcept {
+            return pages_[swarIndex / PageSWARs]->md_[swarIndex % PageSWARs];
+        }
+
+        void setMetadata(std::size_t swarIndex, MD md) {
+            writablePage(swarIndex / PageSWARs).md_[swarIndex % PageSWARs] = md;
+        }
+
+        const Slot &slot(std::size_t index) const noexcept {
+            return pages_[index / PageSlots]->values_[index % PageSlots];
+        }
+
+        Slot &writableSlot(std::size_t index) {
+            return writablePage(index / PageSlots).values_[index % PageSlots];
+        }
+
+        /// The number of pages shared with snapshots, or still empty
+        std::size_t sharedPageCount() const noexcept {
+            std::size_t rv = 0;
+            for(auto &page: pages_) { rv += 1 < page.use_count(); }
+            return rv;
+        }
+    };
+};
+
+/// \brief Frontend with copy-on-write pages, its copies are snapshots
+template<
+    typename K,
+    typename MV,
+    std::size_t RequestedSize,
+    int PSL_Bits, int HashBits,
+    std::size_t PageSlots = 512,
+    typename Hash = std::hash<K>,
+    typename KE = std::equal_to<K>,
+    typename U = std::uint64_t
+>
+using RH_Frontend_CopyOnWrite =
+    RH_Frontend_WithSkarupkeTail<
+        K, MV, RequestedSize, PSL_Bits, HashBits, Hash, KE, U,
+        FibonacciScatter<U>,
+        LemireReduce<RequestedSize, U>,
+        TopHashReducer<HashBits, U>,
+        CopyOnWritePages<PageSlots>
+    >;
+
+/// \brief A consistent, immutable view of \c table as of now, sharing its
+/// pages
+template<typename Table>
+std::shared_ptr<const Table> snapshot(const Table &table) {
+    return std::make_shared<const Table>(table);
+}
+
+} // rh
+} // zoo
+
+#endif
@@ -41,14 +41,15 @@ struct MisalignedGenerator<T, 0>: GeneratorFromPointer<T> {};
 
 // This is tightly coupled with a Metadata that happens-to have lane widths of
 // 8.
-template<typename T>
+// Cursor is anything that can be indexed and incremented like a pointer to T
+template<typename T, typename Cursor = T *>
 struct MisalignedGenerator_Dynamic {
     constexpr static auto Width = sizeof(T) * 8;
-    T *base_;
+    Cursor base_;
 
     int misalignmentFirst, misalignmentSecondLessOne;
 
-    MisalignedGenerator_Dynamic(T *base, int ma):
+    MisalignedGenerator_Dynamic(Cursor base, int ma):
         base_(base),
         misalignmentFirst(ma), misalignmentSecondLessOne(Width - ma - 1)
     {}
@@ -88,6 +89,22 @@ struct Metadata: swar::SWARWithSubLanes<PSL_Bits, HashBits, U> {
 
     constexpr auto PSLs() const noexcept { return this->least(); }
     constexpr auto hashes() const noexcept { return this->most(); }
+
+    /// \brief Boolean SWAR of the lanes whose element has the same home
+    /// index as the element in the lane before
+    ///
+    /// The home index is the slot index minus the PSL (plus one), hence an
+    /// element has the same home as the one before if its PSL is the next:
+    /// the runs of elements of the same home, the equivalence classes of the
+    /// hash, are progressions of PSLs.
+    /// \c previousPSL is the PSL of the slot before the first lane.
+    constexpr auto sameHomeAsPrevious(U previousPSL) const noexcept {
+        using S = swar::SWAR<Base::NBits, U>;
+        constexpr auto Ones = S{meta::BitmaskMaker<U, 1, Base::NBits>::value};
+        S psls = PSLs();
+        auto before = S{U(psls.shiftLanesLeft(1).value() | previousPSL)};
+        return equals(psls, before + Ones) & booleans(before);
+    }
 };
 
 template<int PSL_Bits, int HashBits, typename U>
@@ -104,10 +121,11 @@ constexpr auto hashReducer(U n) noexcept {
     constexpr auto AllOnes = meta::BitmaskMaker<U, 1, NBits>::value;
     auto temporary = AllOnes * n;
     auto higestNBits = temporary >> Shift;
-    return
-        (0 == (64 % NBits)) ?
-            higestNBits :
-            swar::isolate<NBits>(higestNBits);
+    if constexpr(0 == (sizeof(U) * 8 % NBits)) {
+        return higestNBits;
+    } else {
+        return higestNBits & ((U(1) << NBits) - 1);
+    }
 }
 
 
@@ -182,6 +200,36 @@ struct UnitaryReducer {
     constexpr auto operator()(U n) noexcept { return 1; }
 };
 
+/// \brief The hashing of a key, reusable to probe any number of tables that
+/// share the Hash, Scatter and HashReduce policies.
+///
+/// The range reduction, which depends on the size of each table, is not
+/// part of the handle, hence the "raw" scattered code.
+/// The key must outlive the handle.
+template<typename K, typename U, typename Hash, typename Scatter, typename HashReduce>
+struct HashedKey {
+    const K *key_;
+    U hoisted_, scattered_;
+
+    constexpr const K &key() const noexcept { return *key_; }
+};
+
+/// Runs the Hash, Scatter and HashReduce policies on the key, once.
+template<
+    typename K,
+    int HashBits,
+    typename U = std::uint64_t,
+    typename Hash = std::hash<K>,
+    typename Scatter = FibonacciScatter<U>,
+    typename HashReduce = TopHashReducer<HashBits, U> >
+constexpr auto hashKey(const K &k) noexcept {
+    auto hashCode = Hash{}(k);
+    return
+        HashedKey<K, U, Hash, Scatter, HashReduce>{
+            &k, U(HashReduce{}(hashCode)), U(Scatter{}(hashCode))
+        };
+}
+
 /// Given a key and sufficient templates specifying its transformation process,
 /// return hoisted hash bits and home index in table.
 template<
@@ -194,11 +242,9 @@ template<
     typename RangeReduce = LemireReduce<RequestedSize, U>,
     typename HashReduce = TopHashReducer<HashBits, U> >
 static constexpr auto findBasicParameters(const K&k) noexcept {
-    auto hashCode = Hash{}(k);
-    auto scattered = Scatter{}(hashCode);
-    auto homeIndex = RangeReduce{}(scattered);
-    auto hoisted = HashReduce{}(hashCode);
-    return std::tuple{hoisted, homeIndex};
+    auto hashed = hashKey<K, HashBits, U, Hash, Scatter, HashReduce>(k);
+    auto homeIndex = RangeReduce{}(hashed.scattered_);
+    return std::tuple{hashed.hoisted_, homeIndex};
 }
 
 template<int NBits>
@@ -207,15 +253,18 @@ constexpr auto cheapOkHash(u64 n) noexcept {
     constexpr u64 allOnes = meta::BitmaskMaker<u64, 1, NBits>::value;
     auto temporary = allOnes * n;
     auto higestNBits = temporary >> shift;
-    return (0 == (64 % NBits)) ?
-        higestNBits : swar::isolate<NBits, u64>(higestNBits);
+    if constexpr(0 == (64 % NBits)) {
+        return higestNBits;
+    } else {
+        return higestNBits & ((u64(1) << NBits) - 1);
+    }
 }
 
 /// Does some multiplies with a lot of hash bits to mix bits, returns only a few
 /// of them.
 template<int NBits> auto badMixer(u64 h) noexcept {
     constexpr u64 allOnes = ~0ull;
-    constexpr u64 mostSigNBits = swar::mostNBitsMask<NBits, u64>();
+    constexpr u64 mostSigNBits = ~u64(0) << (64 - NBits);
     auto tmp = h * allOnes;
 
     auto mostSigBits = tmp & mostSigNBits;
@@ -93,10 +93,10 @@ struct StrawmanMap {
             auto tmppsl = md_.psls_[offset];
             auto tmphash = md_.hashes_[offset];
             auto tmpkey = keys_[offset];
-            md_.psls_[offset] = offset-slot;
+            md_.psls_[offset] = offset-slot+1;
             md_.hashes_[offset] = hashbits;
             keys_[offset] = k;
-            slot = offset-tmppsl;
+            slot = offset-tmppsl+1;
             hashbits = tmphash;
             k = tmpkey;
             offset+=1;
@@ -0,0 +1,177 @@
+#ifndef ZOO_MAP_STRING_INTERNER_H
+#define ZOO_MAP_STRING_INTERNER_H
+
+#include "zoo/map/RobinHood.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/*! \file StringInterner.h
+\brief Interning of strings into stable 32-bit identifiers
+
+The characters of all interned strings are stored contiguously, one after the
+other, in a "bump" arena: a single buffer that only grows at its end.  The
+Robin Hood table does not hold strings but offsets into the arena, and the
+identifiers as mapped values, hence there is no allocation per string.
+*/
+
+namespace zoo {
+namespace rh {
+
+struct InterningCapacityExhausted: RobinHoodException {
+    using RobinHoodException::RobinHoodException;
+};
+
+namespace impl {
+
+/// \brief Index of the first byte that differs in two ranges of \c count
+/// bytes, \c count if they are equal
+///
+/// Compares eight bytes at a time with SWAR \c differents (the negation of
+/// \c equals), the least significant true lane is the first difference.
+inline std::size_t
+firstDifferentByte(const char *a, const char *b, std::size_t count) noexcept {
+    using S = swar::SWAR<8, u64>;
+    auto load = [](const char *source, std::size_t bytes) {
+        u64 rv = 0;
+        memcpy(&rv, source, bytes);
+        return S{rv};
+    };
+    std::size_t index = 0;
+    for(; index + sizeof(u64) <= count; index += sizeof(u64)) {
+        auto different =
+            differents(load(a + index, sizeof(u64)), load(b + index, sizeof(u64)));
+        if(different) { return index + different.lsbIndex(); }
+    }
+    if(index == count) { return count; }
+    auto remaining = count - index;
+    auto different =
+        differents(load(a + index, remaining), load(b + index, remaining));
+    // the lanes past the remaining bytes are zero in both
+    return different ? index + different.lsbIndex() : count;
+}
+
+inline bool
+equalBytes(const char *a, const char *b, std::size_t count) noexcept {
+    return count == firstDifferentByte(a, b, count);
+}
+
+} // impl
+
+/// \brief Maps strings to stable, dense, 32-bit identifiers
+///
+/// Each interned string is stored once in the arena, prefixed by its length
+/// as a 32-bit integer.  The table maps the offset of the length prefix to
+/// the identifier.  Identifiers are assigned in order of first interning,
+/// starting at 0; they and the views returned by \c view remain valid for the
+/// lifetime of the interner, except that views are invalidated by the arena
+/// growing.
+template<std::size_t Capacity, int PSL_Bits = 6, int HashBits = 10>
+struct StringInterner {
+    using ID = u32;
+    using U = u64;
+    using Table = RH_Frontend_WithSkarupkeTail<u32, ID, Capacity, PSL_Bits, HashBits>;
+    using StringHash = std::hash<std::string_view>;
+    using Scatter = FibonacciScatter<U>;
+    using RangeReduce = LemireReduce<Capacity, U>;
+    using HashReduce = TopHashReducer<HashBits, U>;
+
+    constexpr static inline std::size_t PrefixSize = sizeof(u32);
+
+    std::unique_ptr<Table> table_;
+    std::vector<char> arena_;
+    std::vector<u32> offsets_; // indexed by ID
+
+    StringInterner(): table_(std::make_unique<Table>()) {}
+
+    std::string_view viewAt(u32 offset) const noexcept {
+        u32 length;
+        memcpy(&length, arena_.data() + offset, PrefixSize);
+        return {arena_.data() + offset + PrefixSize, length};
+    }
+
+    std::string_view view(ID id) const noexcept { return viewAt(offsets_[id]); }
+
+    std::size_t size() const noexcept { return offsets_.size(); }
+
+    /// \brief Bytes used by the table, arena and identifier index
+    std::size_t memoryFootprint() const noexcept {
+        return
+            sizeof(Table) + arena_.capacity() + offsets_.capacity() * sizeof(u32);
+    }
+
+    auto parameters(std::string_view s) const noexcept {
+        auto hk = hashKey<std::string_view, HashBits, U, StringHash, Scatter, HashReduce>(s);
+        auto homeIndex = RangeReduce{}(hk.scattered_);
+        return
+            std::tuple{
+                hk.hoisted_,
+                homeIndex,
+                [thy = this, s](std::size_t ndx) noexcept {
+                    auto candidate =
+                        thy->viewAt(thy->table_->slot(ndx).value().first);
+                    return
+                        candidate.size() == s.size() &&
+                        impl::equalBytes(candidate.data(), s.data(), s.size());
+                }
+            };
+    }
+
+    /// \brief The identifier of \c s, if interned, or \c size() otherwise
+    ID find(std::string_view s) const noexcept {
+        auto [hoisted, homeIndex, kc] = parameters(s);
+        auto where = table_->findKnowingParameters(hoisted, homeIndex, kc);
+        return table_->end() == where ? ID(size()) : where->second;
+    }
+
+    /// \brief Returns the identifier of \c s, interning it if new
+    ///
+    /// The string is appended to the arena before probing, so that a single
+    /// probe both finds and inserts; if it was already present the arena is
+    /// trimmed back.
+    ID intern(std::string_view s) {
+        auto offset = arena_.size();
+        if(
+            std::numeric_limits<u32>::max() < offset + PrefixSize + s.size() ||
+            std::numeric_limits<u32>::max() <= offsets_.size()
+        ) {
+            throw InterningCapacityExhausted("32-bit offsets or identifiers");
+        }
+        // s may be a view into the arena, which may be reallocated
+        auto aliases =
+            !std::less<const char *>{}(s.data(), arena_.data()) &&
+            std::less<const char *>{}(s.data(), arena_.data() + offset);
+        auto sourceOffset = aliases ? s.data() - arena_.data() : 0;
+        u32 length = u32(s.size());
+        arena_.resize(offset + PrefixSize + s.size());
+        if(aliases) { s = {arena_.data() + sourceOffset, s.size()}; }
+        memcpy(arena_.data() + offset, &length, PrefixSize);
+        memcpy(arena_.data() + offset + PrefixSize, s.data(), s.size());
+        auto nextID = ID(offsets_.size());
+        try {
+            offsets_.push_back(u32(offset));
+            auto [hoisted, homeIndex, kc] = parameters(s);
+            auto [where, inserted] =
+                table_->insertKnowingParameters(
+                    hoisted, homeIndex, kc,
+                    typename Table::value_type{u32(offset), nextID}
+                );
+            if(inserted) { return nextID; }
+            offsets_.pop_back();
+            arena_.resize(offset);
+            return where->second;
+        } catch(...) {
+            offsets_.resize(nextID);
+            arena_.resize(offset);
+            throw;
+        }
+    }
+};
+
+} // rh
+} // zoo
+
+#endif
@@ -43,6 +43,22 @@ struct BitmaskMaker {
 static_assert(0xF0F0 == BitmaskMaker<uint16_t, 0xF0, 8>::value);
 static_assert(0xEDFEDFED == BitmaskMaker<uint32_t, 0xFED, 12>::value);
 
+/// \brief Function form of \c BitmaskMaker, for the types that can not be
+/// template parameters in C++ 17, such as class types modeling integers
+template<typename T>
+constexpr T makeBitmask(T current, int currentSize) {
+    constexpr int Width = sizeof(T) * 8;
+    if(Width < currentSize * 2) { return current; }
+    for(; currentSize < Width; currentSize *= 2) {
+        current = T(current | (current << currentSize));
+    }
+    return current;
+}
+
+static_assert(0xF0F0 == makeBitmask<uint16_t>(0xF0, 8));
+static_assert(0xEDFEDFED == makeBitmask<uint32_t>(0xFED, 12));
+static_assert(0xFED == makeBitmask<uint32_t>(0xFED, 20));
+
 }} // zoo::meta
 
 #endif
@@ -0,0 +1,41 @@
+#ifndef ZOO_META_RELOCATABLE_H
+#define ZOO_META_RELOCATABLE_H
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace zoo { namespace meta {
+
+/// \brief Whether the objects of type \c T can be relocated by copying their
+/// bytes
+///
+/// To relocate is to move an object to another address and end the lifetime
+/// of the source, as if by a move construction followed by the destruction
+/// of the source.  For most types this is equivalent to copying the bytes and
+/// forgetting the source, the exceptions are types that refer to themselves,
+/// such as strings with the "small string optimization" that point to their
+/// internal buffer.
+/// Trivially copyable types are relocatable, specialize for other types known
+/// to be.
+template<typename T>
+struct is_trivially_relocatable: std::is_trivially_copyable<T> {};
+
+template<typename T1, typename T2>
+struct is_trivially_relocatable<std::pair<T1, T2>>:
+    std::conjunction<is_trivially_relocatable<T1>, is_trivially_relocatable<T2>>
+{};
+
+template<typename T>
+struct is_trivially_relocatable<std::unique_ptr<T>>: std::true_type {};
+
+template<typename T>
+struct is_trivially_relocatable<std::shared_ptr<T>>: std::true_type {};
+
+template<typename T>
+constexpr inline bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+}}
+
+#endif
@@ -26,12 +26,24 @@ using copy_cr_t = typename copy_cr<Type, Reference>::type;
 template<typename T>
 using remove_cr_t = std::remove_const_t<std::remove_reference_t<T>>;
 
+/// \brief \c std::make_unsigned for the integral types, the type itself
+/// otherwise: the class types that model unsigned integers
+template<typename T, bool = std::is_integral_v<T> || std::is_enum_v<T>>
+struct make_unsigned { using type = std::make_unsigned_t<T>; };
+
+template<typename T>
+struct make_unsigned<T, false> { using type = T; };
+
+template<typename T>
+using make_unsigned_t = typename make_unsigned<T>::type;
+
 #ifdef COMPILE_TIME_TESTS
 
 static_assert(std::is_same_v<char &, copy_cr_t<char, int &>>);
 static_assert(std::is_same_v<char &&, copy_cr_t<char, int &&>>);
 static_assert(std::is_same_v<const char &, copy_cr_t<char, const int &>>);
 static_assert(std::is_same_v<const char &&, copy_cr_t<char, const int &&>>);
+static_assert(std::is_same_v<unsigned, make_unsigned_t<int>>);
 
 #endif
 
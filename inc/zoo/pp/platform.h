@@ -7,6 +7,12 @@
 #define ZOO_CONFIGURED_TO_USE_AVX() 0
 #endif
 
+#ifdef __AVX512BW__
+#define ZOO_CONFIGURED_TO_USE_AVX512() 1
+#else
+#define ZOO_CONFIGURED_TO_USE_AVX512() 0
+#endif
+
 #if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (defined(__aarch64__) || defined(_M_ARM64))
 #define ZOO_CONFIGURED_TO_USE_NEON() 1
 #else
@@ -19,6 +25,16 @@
 #define ZOO_CONFIGURED_TO_USE_BMI() 0
 #endif
 
+/// Instruction set extensions may be used in functions compiled for them and
+/// selected at run time, see zoo/root/cpu.h
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS() 1
+#define ZOO_TARGET(extensions) __attribute__((target(extensions)))
+#else
+#define ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS() 0
+#define ZOO_TARGET(extensions)
+#endif
+
 #ifdef _MSC_VER
 #define MSVC_EMPTY_BASES __declspec(empty_bases)
 #else
@@ -0,0 +1,84 @@
+#ifndef ZOO_ROOT_CPU_H
+#define ZOO_ROOT_CPU_H
+
+/// \file zoo/root/cpu.h Detection of the instruction set extensions at run
+/// time, and dispatch of functions to the implementations the processor
+/// supports
+
+#include "zoo/pp/platform.h"
+
+#include <atomic>
+
+namespace zoo {
+
+/// \brief The instruction set extensions relevant to the SWAR kernels that
+/// the processor, and the operating system, support
+struct CPUFeatures {
+    bool bmi2, avx2, avx512bw;
+};
+
+/// \note without run time detection, what the compilation is configured for
+inline CPUFeatures detectCPUFeatures() noexcept {
+    #if ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+        // the detection may happen before the initialization of the runtime
+        __builtin_cpu_init();
+        return {
+            bool(__builtin_cpu_supports("bmi2")),
+            bool(__builtin_cpu_supports("avx2")),
+            bool(__builtin_cpu_supports("avx512bw"))
+        };
+    #else
+        return {
+            ZOO_CONFIGURED_TO_USE_BMI(),
+            ZOO_CONFIGURED_TO_USE_AVX(),
+            ZOO_CONFIGURED_TO_USE_AVX512()
+        };
+    #endif
+}
+
+/// Detected once per program
+inline const CPUFeatures &cpuFeatures() noexcept {
+    static const auto rv = detectCPUFeatures();
+    return rv;
+}
+
+/// \brief A function whose implementation is selected at its first call
+/// according to \c cpuFeatures
+///
+/// The selection is kept in a function pointer initialized at compile time
+/// to a trampoline that resolves and calls, which is the mechanism of the
+/// ELF "ifunc" without the dependency on the loader, nor the issues of the
+/// order of initialization of static objects: calls during the static
+/// initialization work.  Afterwards, a call costs an indirect call.
+/// \tparam Resolver has the static member function \c resolve that returns
+/// the pointer to the implementation given the \c CPUFeatures
+template<typename Resolver, typename Signature>
+struct Dispatched;
+
+template<typename Resolver, typename R, typename... Args>
+struct Dispatched<Resolver, R(Args...)> {
+    using Pointer = R (*)(Args...);
+
+    static R call(Args... args) {
+        return selected_.load(std::memory_order_relaxed)(args...);
+    }
+
+    /// The implementation for this processor
+    static Pointer resolved() noexcept {
+        return Resolver::resolve(cpuFeatures());
+    }
+
+private:
+    static R resolveAndCall(Args... args) {
+        auto implementation = resolved();
+        // All threads would store the same value
+        selected_.store(implementation, std::memory_order_relaxed);
+        return implementation(args...);
+    }
+
+    static inline std::atomic<Pointer> selected_{resolveAndCall};
+};
+
+}
+
+#endif
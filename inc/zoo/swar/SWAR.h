@@ -3,6 +3,7 @@
 /// \file Swar.h SWAR operations
 
 #include "zoo/meta/log.h"
+#include "zoo/meta/traits.h"
 
 #include <array>
 #include <type_traits>
@@ -41,7 +42,7 @@ constexpr uint64_t popcount(uint64_t a) noexcept {
 
 /// Index into the bits of the type T that contains the MSB.
 template<typename T>
-constexpr std::make_unsigned_t<T> msbIndex(T v) noexcept {
+constexpr meta::make_unsigned_t<T> msbIndex(T v) noexcept {
     return meta::logFloor(v);
 }
 
@@ -49,7 +50,7 @@ constexpr std::make_unsigned_t<T> msbIndex(T v) noexcept {
 ///
 /// \todo incorporate __builtin_ctzg when it is more widely available
 template<typename T>
-constexpr std::make_unsigned_t<T> lsbIndex(T v) noexcept {
+constexpr meta::make_unsigned_t<T> lsbIndex(T v) noexcept {
     // This check should be SFINAE, but supporting all sorts
     // of base types is an ongoing task, we put a bare-minimum
     // temporary preventive measure with static_assert
@@ -58,7 +59,7 @@ constexpr std::make_unsigned_t<T> lsbIndex(T v) noexcept {
         // ~v & (v - 1) turns on all trailing zeroes, zeroes the rest
         return meta::logFloor(1 + (~v & (v - 1)));
     #else
-        return ~v ? __builtin_ctzll(v) : sizeof(T) * 8;
+        return v ? __builtin_ctzll(v) : sizeof(T) * 8;
     #endif
 }
 
@@ -75,25 +76,36 @@ constexpr __uint128_t lsbIndex(__uint128_t v) noexcept {
 /// SIMD operations against that primitive type T treated as a SIMD register.
 /// SWAR operations are usually constant time, log(lane count) cost, or O(lane count) cost.
 /// Certain computational workloads can be materially sped up using SWAR techniques.
+/// T may also be a class type that models an unsigned integer, such as
+/// \c VectorRegister
+///
+/// When NBits does not divide the width of T, such as 5 or 12 bits in 64,
+/// the most significant \c PaddingBitsCount bits are padding: the constants
+/// do not set them, the lane-wise operations ignore their contents, and the
+/// shifts of whole lanes clear them.
 template<int NBits_, typename T = uint64_t>
 struct SWAR {
-    using type = std::make_unsigned_t<T>;
+    using type = meta::make_unsigned_t<T>;
+    /// The type of the counts of bits and lanes, \c type for integers
+    using CountType = std::conditional_t<std::is_class_v<type>, int, type>;
     constexpr static auto Literal = Literals<NBits_, T>;
-    constexpr static inline type
+    constexpr static inline CountType
         NBits = NBits_,
         BitWidth = sizeof(T) * 8,
         Lanes = BitWidth / NBits,
         NSlots = Lanes,
         PaddingBitsCount = BitWidth % NBits,
-        SignificantBitsCount = BitWidth - PaddingBitsCount,
-        AllOnes = ~type{0} >> PaddingBitsCount,
+        SignificantBitsCount = BitWidth - PaddingBitsCount;
+    constexpr static inline type
+        AllOnes = type(~type{0}) >> PaddingBitsCount,
             // Also constructed in RobinHood utils: possible bug?
-        LeastSignificantBit = meta::BitmaskMaker<T, type{1}, NBits>::value,
+        // the repetition of the pattern would set padding bits
+        LeastSignificantBit = type(meta::makeBitmask(type{1}, NBits) & AllOnes),
         MostSignificantBit = LeastSignificantBit << (NBits - 1),
         LeastSignificantLaneMask =
             sizeof(T) * 8 == NBits ? // needed to avoid shifting all bits
                 type(~T(0u)) :
-                ~(type(~type(0u)) << type{NBits}),
+                type(~type(type(~type(0u)) << NBits)),
         // Use LowerBits in favor of ~MostSignificantBit to not pollute
         // "don't care" bits when non-power-of-two bit lane sizes are supported
         LowerBits = MostSignificantBit - LeastSignificantBit,
@@ -158,12 +170,12 @@ struct SWAR {
 
     // Returns lane at position with other lanes cleared.
     constexpr T isolateLane(int position) const noexcept {
-        return m_v & (LeastSignificantLaneMask << T(NBits * position));
+        return m_v & (LeastSignificantLaneMask << (NBits * position));
     }
 
     // Returns lane value at position, in lane 0, rest of SWAR cleared.
     constexpr T at(int position) const noexcept {
-        return LeastSignificantLaneMask & (m_v >> T(NBits * position));
+        return LeastSignificantLaneMask & (m_v >> (NBits * position));
     }
 
     constexpr SWAR clear(int position) const noexcept {
@@ -175,8 +187,15 @@ struct SWAR {
 
     /// The SWAR lane index that contains the MSB.  It is not the bit index of the MSB.
     /// IE: 4 bit wide 32 bit SWAR: 0x0040'0000 will return 5, not 22 (0 indexed).
-    constexpr auto top() const noexcept { return msbIndex(m_v) / NBits; }
-    constexpr auto lsbIndex() const noexcept { return swar::lsbIndex(m_v) / NBits; }
+    constexpr auto top() const noexcept {
+        return msbIndex(significantBits()) / NBits;
+    }
+    /// The index of the least significant lane not zero, \c Lanes if none
+    constexpr auto lsbIndex() const noexcept {
+        // the overloads for class types are found by argument dependent lookup
+        using swar::lsbIndex;
+        return lsbIndex(significantBits()) / NBits;
+    }
 
     constexpr SWAR setBit(int index, int bit) const noexcept {
         return SWAR(m_v | (T(1) << (index * NBits + bit)));
@@ -194,11 +213,21 @@ struct SWAR {
     }
 
     constexpr SWAR shiftLanesLeft(int laneCount) const noexcept {
-        return SWAR(value() << (NBits * laneCount));
+        return SWAR(T(value() << (NBits * laneCount))).withoutPadding();
     }
 
     constexpr SWAR shiftLanesRight(int laneCount) const noexcept {
-        return SWAR(value() >> (NBits * laneCount));
+        return SWAR(T(significantBits() >> (NBits * laneCount)));
+    }
+
+    /// The value with the padding bits cleared, free without padding
+    constexpr T significantBits() const noexcept {
+        if constexpr(0 == PaddingBitsCount) { return m_v; }
+        else { return T(m_v & AllOnes); }
+    }
+
+    constexpr SWAR withoutPadding() const noexcept {
+        return SWAR(significantBits());
     }
 
     /// \brief as the name suggests
@@ -213,9 +242,8 @@ struct SWAR {
     #define X(name, op) \
         constexpr SWAR \
         shiftIntraLane##name(int bitCount, SWAR protectiveMask) const noexcept { \
-            T shiftC = static_cast<T>(bitCount); \
             auto V = (*this & protectiveMask).value(); \
-            auto rv = static_cast<T>(V op shiftC); \
+            auto rv = static_cast<T>(V op bitCount); \
             return SWAR{rv}; \
         }
     SHIFT_INTRALANE_OP_X_LIST
@@ -293,8 +321,7 @@ constexpr auto isolateLSBits(T v) {
 /// Precondition: 0th lane of |v| contains a value to broadcast, remainder of input SWAR zero.
 template<int NBits, typename T = uint64_t>
 constexpr auto broadcast(SWAR<NBits, T> v) {
-    constexpr T Ones = meta::BitmaskMaker<T, 1, NBits>::value;
-    return SWAR<NBits, T>(T(v) * Ones);
+    return SWAR<NBits, T>(T(T(v) * SWAR<NBits, T>::LeastSignificantBit));
 }
 
 /// BooleanSWAR treats the MSB of each SWAR lane as the boolean associated with that lane.
@@ -351,7 +378,7 @@ struct BooleanSWAR: SWAR<NBits, T> {
     }
 
     explicit
-    constexpr operator bool() const noexcept { return this->m_v; }
+    constexpr operator bool() const noexcept { return bool(this->m_v); }
  private:
     constexpr BooleanSWAR(Base initializer) noexcept:
         SWAR<NBits, T>(initializer)
@@ -404,11 +431,9 @@ constantIsGreaterEqual(SWAR<NBits, T> subtrahend) noexcept {
     static_assert(1 < NBits, "Degenerated SWAR");
     constexpr auto MSB_Position  = NBits - 1;
     constexpr auto MSB = T(1) << MSB_Position;
-    constexpr auto MSB_Mask =
-        SWAR<NBits, T>{meta::BitmaskMaker<T, MSB, NBits>::value};
-    constexpr auto Minuend =
-        SWAR<NBits, T>{meta::BitmaskMaker<T, N, NBits>::value};
-    constexpr auto N_MSB = MSB & N;
+    constexpr auto MSB_Mask = SWAR<NBits, T>{meta::makeBitmask(T(MSB), NBits)};
+    constexpr auto Minuend = SWAR<NBits, T>{meta::makeBitmask(T(N), NBits)};
+    constexpr auto N_MSB = MSB & T(N);
 
     auto subtrahendWithMSB_on = MSB_Mask & subtrahend;
     auto subtrahendWithMSB_off = ~subtrahendWithMSB_on;
@@ -436,8 +461,8 @@ constantIsGreaterEqual_MSB_off(SWAR<NBits, T> subtrahend) noexcept {
     static_assert(1 < NBits, "Degenerated SWAR");
     constexpr auto MSB_Position  = NBits - 1;
     constexpr auto MSB = T(1) << MSB_Position;
-    constexpr auto MSB_Mask = meta::BitmaskMaker<T, MSB, NBits>::value;
-    constexpr auto Minuend = meta::BitmaskMaker<T, N, NBits>::value;
+    constexpr auto MSB_Mask = meta::makeBitmask(T(MSB), NBits);
+    constexpr auto Minuend = meta::makeBitmask(T(N), NBits);
     constexpr auto N_MSB = MSB & Minuend;
 
     auto subtrahendWithMSB_on = subtrahend;
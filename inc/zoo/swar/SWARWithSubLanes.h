@@ -48,7 +48,7 @@ struct SWARWithSubLanes: SWAR<NBitsLeast_ + NBitsMost_ , T> {
     using SL = SWARWithSubLanes<NBitsLeast, NBitsMost, T>;
 
     static constexpr inline auto LeastOnes =
-        Base(meta::BitmaskMaker<T, Base{1}.value(), LaneBits>::value);
+        Base(Base::LeastSignificantBit);
     static constexpr inline auto MostOnes =
         Base(LeastOnes.value() << NBitsLeast);
     static constexpr inline auto LeastMask = MostOnes - LeastOnes;
@@ -0,0 +1,325 @@
+#ifndef ZOO_SWAR_VECTOR_REGISTER_H
+#define ZOO_SWAR_VECTOR_REGISTER_H
+
+#include "zoo/pp/platform.h"
+
+#if ZOO_CONFIGURED_TO_USE_AVX()
+#include <immintrin.h>
+#elif ZOO_CONFIGURED_TO_USE_NEON()
+#include <arm_neon.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+/*! \file VectorRegister.h
+\brief Unsigned integers as wide as a vector register, to be the \c T of
+\c SWAR
+
+\c SWAR<8, VectorRegister<256>> processes 32 byte lanes per operation with the
+same code as \c SWAR<8, uint64_t>: the bitwise operations are vector
+instructions, the shifts move the 64 bit limbs across the register, and the
+additions and subtractions propagate the carries across the limbs, because the
+SWAR algorithms rely on the semantics of a single wide integer.  Most SWAR
+operations do not carry across lanes, hence, most of the time the propagation
+costs only the check that there is nothing to propagate.
+
+The implementation uses the vector extensions of GCC and Clang: the same code
+is compiled to SSE2 or NEON for 128 bits, AVX2 for 256 and AVX-512 for 512 as
+the compiler options allow, wider registers are emulated with several.
+*/
+
+#ifndef _MSC_VER
+
+namespace zoo { namespace swar {
+
+namespace impl {
+
+/// GCC ignores a vector size that depends on a template parameter of the
+/// class being defined
+template<int Bytes>
+struct LimbVector {
+    typedef uint64_t type __attribute__((vector_size(Bytes)));
+};
+
+#if ZOO_CONFIGURED_TO_USE_AVX() || ZOO_CONFIGURED_TO_USE_NEON()
+/// The vector test instruction, the compilers do not generate it from the
+/// reduction of the limbs.  Vectors wider than the registers combine their
+/// halves first
+template<int Bytes>
+bool anyBitSet(typename LimbVector<Bytes>::type v) noexcept {
+    #if ZOO_CONFIGURED_TO_USE_AVX()
+    if constexpr(16 == Bytes) {
+        auto asInteger = __m128i(v);
+        return !_mm_testz_si128(asInteger, asInteger);
+    } else if constexpr(32 == Bytes) {
+        auto asInteger = __m256i(v);
+        return !_mm256_testz_si256(asInteger, asInteger);
+    } else
+    #else
+    if constexpr(16 == Bytes) {
+        return vmaxvq_u32(vreinterpretq_u32_u64(uint64x2_t(v)));
+    } else
+    #endif
+    {
+        typename LimbVector<Bytes / 2>::type low, high;
+        memcpy(&low, &v, Bytes / 2);
+        memcpy(&high, reinterpret_cast<char *>(&v) + Bytes / 2, Bytes / 2);
+        return anyBitSet<Bytes / 2>(low | high);
+    }
+}
+#endif
+
+}
+
+/// \brief Unsigned integer of \c Bits bits held in a vector register
+/// \note the multiplication is the schoolbook algorithm, limb by limb, it is
+/// meant for constants, such as in \c broadcast
+template<int Bits>
+struct alignas(Bits / 8) VectorRegister {
+    static_assert(
+        128 <= Bits && 0 == (Bits & (Bits - 1)),
+        "Vector registers are powers of two of at least 128 bits"
+    );
+
+    using Limb = uint64_t;
+    constexpr static inline int Limbs = Bits / 64;
+    using Vector = typename impl::LimbVector<Bits / 8>::type;
+
+    Vector v_;
+
+    VectorRegister() = default;
+    /// Zero extension, as for integers
+    constexpr VectorRegister(Limb low) noexcept: v_{low} {}
+
+    constexpr static VectorRegister fromVector(const Vector &v) noexcept {
+        VectorRegister rv(0);
+        rv.v_ = v;
+        return rv;
+    }
+
+    /// \param c gives the value of the limb at the index passed
+    template<typename Callable>
+    constexpr static VectorRegister generate(Callable c) noexcept {
+        return generate(c, std::make_index_sequence<Limbs>{});
+    }
+
+    constexpr Limb limb(int index) const noexcept { return v_[index]; }
+
+    /// The limb \c i of the result is the limb <tt>i - count</tt>, or 0
+    /// \pre <tt>0 <= count < Limbs</tt>
+    constexpr VectorRegister limbsUp(int count) const noexcept {
+        return moveLimbsByBits<1>(count);
+    }
+
+    /// The limb \c i of the result is the limb <tt>i + count</tt>, or 0
+    /// \pre <tt>0 <= count < Limbs</tt>
+    constexpr VectorRegister limbsDown(int count) const noexcept {
+        return moveLimbsByBits<-1>(count);
+    }
+
+    /// \c limbsUp with a constant count, a single shuffle instruction
+    template<int Count>
+    constexpr VectorRegister limbsUp() const noexcept {
+        return moveLimbs<Count>(v_, std::make_index_sequence<Limbs>{});
+    }
+
+    /// \c limbsDown with a constant count, a single shuffle instruction
+    template<int Count>
+    constexpr VectorRegister limbsDown() const noexcept {
+        return moveLimbs<-Count>(v_, std::make_index_sequence<Limbs>{});
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        #if ZOO_CONFIGURED_TO_USE_AVX() || ZOO_CONFIGURED_TO_USE_NEON()
+        if(!__builtin_is_constant_evaluated()) {
+            return impl::anyBitSet<Bits / 8>(v_);
+        }
+        #endif
+        Limb any = 0;
+        for(int i = 0; i < Limbs; ++i) { any |= v_[i]; }
+        return any;
+    }
+
+    /// Truncation to the least significant limb, as for integers
+    constexpr explicit operator Limb() const noexcept { return v_[0]; }
+
+    constexpr VectorRegister operator~() const noexcept {
+        return fromVector(~v_);
+    }
+
+    #define ZOO_VECTOR_REGISTER_BITWISE_X_LIST X(&) X(|) X(^)
+    #define X(op) \
+        friend constexpr VectorRegister \
+        operator op(VectorRegister l, VectorRegister r) noexcept { \
+            return fromVector(l.v_ op r.v_); \
+        }
+    ZOO_VECTOR_REGISTER_BITWISE_X_LIST
+    #undef X
+    #undef ZOO_VECTOR_REGISTER_BITWISE_X_LIST
+
+    /// \pre <tt>0 <= count < Bits</tt>, as for integers
+    constexpr VectorRegister operator<<(int count) const noexcept {
+        auto limbs = limbsUp(count / 64);
+        auto bits = count % 64;
+        if(!bits) { return limbs; }
+        return
+            fromVector((limbs.v_ << bits) | (limbs.template limbsUp<1>().v_ >> (64 - bits)));
+    }
+
+    /// \pre <tt>0 <= count < Bits</tt>, as for integers
+    constexpr VectorRegister operator>>(int count) const noexcept {
+        auto limbs = limbsDown(count / 64);
+        auto bits = count % 64;
+        if(!bits) { return limbs; }
+        return
+            fromVector((limbs.v_ >> bits) | (limbs.template limbsDown<1>().v_ << (64 - bits)));
+    }
+
+    /// The carries are tested before moving them to their limbs, because the
+    /// test of a mask is a single instruction
+    friend constexpr VectorRegister
+    operator+(VectorRegister l, VectorRegister r) noexcept {
+        auto sum = l.v_ + r.v_;
+        // the limbs that overflowed are smaller than an addend
+        auto overflowed = Vector(sum < l.v_);
+        for(;;) {
+            if(!fromVector(overflowed & BelowTopLimb)) { return fromVector(sum); }
+            auto carries = fromVector(overflowed & 1).template limbsUp<1>().v_;
+            auto next = sum + carries;
+            // only the limbs with all bits set overflow adding the carry
+            overflowed = Vector(next < sum);
+            sum = next;
+        }
+    }
+
+    friend constexpr VectorRegister
+    operator-(VectorRegister l, VectorRegister r) noexcept {
+        auto difference = l.v_ - r.v_;
+        auto borrowed = Vector(l.v_ < r.v_);
+        for(;;) {
+            if(!fromVector(borrowed & BelowTopLimb)) {
+                return fromVector(difference);
+            }
+            auto borrows = fromVector(borrowed & 1).template limbsUp<1>().v_;
+            auto next = difference - borrows;
+            borrowed = Vector(difference < borrows);
+            difference = next;
+        }
+    }
+
+    /// Truncated to \c Bits, as for integers
+    friend constexpr VectorRegister
+    operator*(VectorRegister l, VectorRegister r) noexcept {
+        Limb product[Limbs] = {};
+        for(int i = 0; i < Limbs; ++i) {
+            Limb carry = 0;
+            for(int j = 0; i + j < Limbs; ++j) {
+                auto partial =
+                    __uint128_t(l.v_[i]) * r.v_[j] + product[i + j] + carry;
+                product[i + j] = Limb(partial);
+                carry = Limb(partial >> 64);
+            }
+        }
+        return generate([&product](int i) { return product[i]; });
+    }
+
+    friend constexpr bool
+    operator==(VectorRegister l, VectorRegister r) noexcept {
+        return !(l ^ r);
+    }
+
+    friend constexpr bool
+    operator!=(VectorRegister l, VectorRegister r) noexcept {
+        return bool(l ^ r);
+    }
+
+    #define ZOO_VECTOR_REGISTER_ASSIGNMENT_X_LIST \
+        X(&, VectorRegister) X(|, VectorRegister) X(^, VectorRegister) \
+        X(+, VectorRegister) X(-, VectorRegister) X(*, VectorRegister) \
+        X(<<, int) X(>>, int)
+    #define X(op, Argument) \
+        constexpr VectorRegister &operator op##=(Argument a) noexcept { \
+            return *this = *this op a; \
+        }
+    ZOO_VECTOR_REGISTER_ASSIGNMENT_X_LIST
+    #undef X
+    #undef ZOO_VECTOR_REGISTER_ASSIGNMENT_X_LIST
+
+private:
+    /// All the bits of the limbs whose carries go to another limb
+    constexpr static inline Vector BelowTopLimb =
+        (~VectorRegister(0)).template limbsDown<1>().v_;
+
+    template<typename Callable, std::size_t... Indices>
+    constexpr static VectorRegister
+    generate(Callable c, std::index_sequence<Indices...>) noexcept {
+        return fromVector(Vector{c(int(Indices))...});
+    }
+
+    /// A constant move per bit of \c count, \c Power is the bit, negative
+    /// to move down
+    template<int Power>
+    constexpr VectorRegister moveLimbsByBits(int count) const noexcept {
+        if constexpr(Limbs <= Power || Limbs <= -Power) { return *this; }
+        else {
+            auto moved =
+                (count & (0 < Power ? Power : -Power)) ?
+                    moveLimbs<Power>(v_, std::make_index_sequence<Limbs>{}) :
+                    *this;
+            return moved.template moveLimbsByBits<2 * Power>(count);
+        }
+    }
+
+    /// The index into the concatenation of 0 and the vector from which the
+    /// limb \c i comes when moving the limbs up by \c Count, down if negative
+    template<int Count>
+    constexpr static int movedFrom(int i) noexcept {
+        auto source = i - Count;
+        return source < 0 || Limbs <= source ? 0 : Limbs + source;
+    }
+
+    /// Takes and returns the vector wrapped, passing or returning the bare
+    /// vector types by value changes the ABI with the instruction set
+    /// (-Wpsabi)
+    template<int Count, std::size_t... Indices>
+    constexpr static VectorRegister
+    moveLimbs(const Vector &v, std::index_sequence<Indices...>) noexcept {
+        constexpr Vector Zero = {};
+        #ifdef __clang__
+        return fromVector(
+            __builtin_shufflevector(Zero, v, movedFrom<Count>(Indices)...)
+        );
+        #else
+        return fromVector(
+            __builtin_shuffle(Zero, v, Vector{Limb(movedFrom<Count>(Indices))...})
+        );
+        #endif
+    }
+};
+
+/// Index of the least significant bit set, \c Bits for 0, found by
+/// argument dependent lookup from \c SWAR
+template<int Bits>
+constexpr int lsbIndex(VectorRegister<Bits> v) noexcept {
+    for(int i = 0; i < v.Limbs; ++i) {
+        if(v.v_[i]) { return 64 * i + __builtin_ctzll(v.v_[i]); }
+    }
+    return Bits;
+}
+
+/// Index of the most significant bit set, -1 for 0
+template<int Bits>
+constexpr int msbIndex(VectorRegister<Bits> v) noexcept {
+    for(int i = v.Limbs; i--; ) {
+        if(v.v_[i]) { return 64 * i + 63 - __builtin_clzll(v.v_[i]); }
+    }
+    return -1;
+}
+
+}}
+
+#endif
+
+#endif
@@ -0,0 +1,209 @@
+#ifndef ZOO_SWAR_WIDE_SWAR_H
+#define ZOO_SWAR_WIDE_SWAR_H
+
+#include "zoo/swar/arithmetic.h"
+
+#include <array>
+#include <cstdint>
+
+/*! \file WideSWAR.h
+\brief SWARs of several words, for bitmaps and arrays of lanes of hundreds of
+bits
+
+\c WideSWAR<NB, N> is an array of \c N words \c SWAR<NB, uint64_t>, its lane
+\c i is the lane <tt>i % LanesPerWord</tt> of the word
+<tt>i / LanesPerWord</tt>.  The lanes do not cross words, then the lane-wise
+operations apply to each word independently, in loops without dependencies
+the compiler can vectorize; only the moves of lanes and the searches of lanes
+go across words.  Unlike \c SWAR<NB, VectorRegister<Bits>>, which is a single
+wide integer, the additions and subtractions do not carry across words: each
+word keeps its own padding when \c NB does not divide 64.
+*/
+
+namespace zoo { namespace swar {
+
+template<int NBits_, int N>
+struct WideSWAR {
+    using Word = SWAR<NBits_, uint64_t>;
+    using Words = std::array<uint64_t, N>;
+    constexpr static inline int
+        NBits = NBits_,
+        WordCount = N,
+        LanesPerWord = Word::Lanes,
+        Lanes = N * LanesPerWord;
+
+    WideSWAR() = default;
+    constexpr explicit WideSWAR(const Words &words) noexcept: m_words(words) {}
+
+    /// All the words with the value \c word
+    constexpr static WideSWAR filled(uint64_t word) noexcept {
+        WideSWAR rv{};
+        for(int i = 0; i < N; ++i) { rv.m_words[i] = word; }
+        return rv;
+    }
+
+    constexpr const Words &words() const noexcept { return m_words; }
+    constexpr Word word(int index) const noexcept {
+        return Word{m_words[index]};
+    }
+
+    constexpr uint64_t at(int lane) const noexcept {
+        return word(lane / LanesPerWord).at(lane % LanesPerWord);
+    }
+
+    constexpr WideSWAR blitElement(int lane, uint64_t value) const noexcept {
+        auto rv = *this;
+        auto shift = NBits * (lane % LanesPerWord);
+        auto &w = rv.m_words[lane / LanesPerWord];
+        w = (w & ~(Word::LeastSignificantLaneMask << shift)) | (value << shift);
+        return rv;
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        uint64_t any = 0;
+        for(int i = 0; i < N; ++i) { any |= word(i).significantBits(); }
+        return any;
+    }
+
+    constexpr WideSWAR operator~() const noexcept {
+        WideSWAR rv{};
+        for(int i = 0; i < N; ++i) { rv.m_words[i] = ~m_words[i]; }
+        return rv;
+    }
+
+    /// The operators apply to each word, the additions and subtractions do
+    /// not carry across words
+    #define ZOO_WIDE_SWAR_BINARY_OPERATORS_X_LIST X(&) X(^) X(|) X(-) X(+)
+    #define X(op) \
+        constexpr WideSWAR operator op(WideSWAR o) const noexcept { \
+            WideSWAR rv{}; \
+            for(int i = 0; i < N; ++i) { \
+                rv.m_words[i] = m_words[i] op o.m_words[i]; \
+            } \
+            return rv; \
+        }
+    ZOO_WIDE_SWAR_BINARY_OPERATORS_X_LIST
+    #undef X
+    #undef ZOO_WIDE_SWAR_BINARY_OPERATORS_X_LIST
+
+    /// The index of the least significant lane not zero, \c Lanes if none
+    constexpr int lsbIndex() const noexcept {
+        for(int i = 0; i < N; ++i) {
+            if(word(i).significantBits()) {
+                return i * LanesPerWord + int(word(i).lsbIndex());
+            }
+        }
+        return Lanes;
+    }
+
+    /// The index of the most significant lane not zero, -1 if none
+    constexpr int top() const noexcept {
+        for(int i = N; i--; ) {
+            if(word(i).significantBits()) {
+                return i * LanesPerWord + int(word(i).top());
+            }
+        }
+        return -1;
+    }
+
+    /// The lane \c i of the result is the lane <tt>i - laneCount</tt>, the
+    /// lanes that leave a word enter the next
+    /// \pre <tt>0 <= laneCount <= Lanes</tt>
+    constexpr WideSWAR shiftLanesLeft(int laneCount) const noexcept {
+        auto wordShift = laneCount / LanesPerWord,
+             laneShift = laneCount % LanesPerWord;
+        WideSWAR rv{};
+        for(int i = wordShift; i < N; ++i) {
+            auto moved = word(i - wordShift).shiftLanesLeft(laneShift).value();
+            if(laneShift && wordShift < i) {
+                moved |=
+                    word(i - wordShift - 1).
+                        shiftLanesRight(LanesPerWord - laneShift).value();
+            }
+            rv.m_words[i] = moved;
+        }
+        return rv;
+    }
+
+    /// The lane \c i of the result is the lane <tt>i + laneCount</tt>
+    /// \pre <tt>0 <= laneCount <= Lanes</tt>
+    constexpr WideSWAR shiftLanesRight(int laneCount) const noexcept {
+        auto wordShift = laneCount / LanesPerWord,
+             laneShift = laneCount % LanesPerWord;
+        WideSWAR rv{};
+        for(int i = 0; i + wordShift < N; ++i) {
+            auto moved = word(i + wordShift).shiftLanesRight(laneShift).value();
+            if(laneShift && i + wordShift + 1 < N) {
+                moved |=
+                    word(i + wordShift + 1).
+                        shiftLanesLeft(LanesPerWord - laneShift).value();
+            }
+            rv.m_words[i] = moved;
+        }
+        return rv;
+    }
+
+    Words m_words;
+};
+
+/// \brief Applies \c operation to the words of the same index of the
+/// arguments, \c operation takes and returns <tt>SWAR<NB, uint64_t></tt>
+/// or \c BooleanSWAR
+template<typename Operation, int NB, int N, typename... Rest>
+constexpr WideSWAR<NB, N>
+transformWords(Operation &&operation, WideSWAR<NB, N> first, Rest... rest) {
+    WideSWAR<NB, N> rv{};
+    for(int i = 0; i < N; ++i) {
+        rv.m_words[i] = operation(first.word(i), rest.word(i)...).value();
+    }
+    return rv;
+}
+
+/// Broadcasts the lane 0 to all the lanes
+/// \pre the other lanes are zero, as for \c SWAR
+template<int NB, int N>
+constexpr WideSWAR<NB, N> broadcast(WideSWAR<NB, N> v) {
+    return WideSWAR<NB, N>::filled(broadcast(v.word(0)).value());
+}
+
+/// The lane-wise operations of \c SWAR, the booleans are the most
+/// significant bits of the lanes, as in \c BooleanSWAR
+#define ZOO_WIDE_SWAR_LANEWISE_X_LIST \
+    X(equals) X(greaterEqual) X(signedGreaterEqual) \
+    X(maximum) X(minimum) X(signedMaximum) X(signedMinimum) \
+    X(saturatingUnsignedSubtraction) \
+    X(saturatingSignedAddition) X(saturatingSignedSubtraction) \
+    X(roundingAverage) X(absoluteDifference)
+#define X(name) \
+    template<int NB, int N> \
+    constexpr WideSWAR<NB, N> \
+    name(WideSWAR<NB, N> a, WideSWAR<NB, N> b) noexcept { \
+        return transformWords( \
+            [](SWAR<NB, uint64_t> x, SWAR<NB, uint64_t> y) { \
+                return name(x, y); \
+            }, \
+            a, b \
+        ); \
+    }
+ZOO_WIDE_SWAR_LANEWISE_X_LIST
+#undef X
+#undef ZOO_WIDE_SWAR_LANEWISE_X_LIST
+
+/// Lane-wise \c ifTrue where the most significant bit of the lane of
+/// \c condition is set, \c ifFalse elsewhere
+template<int NB, int N>
+constexpr WideSWAR<NB, N> select(
+    WideSWAR<NB, N> condition, WideSWAR<NB, N> ifTrue, WideSWAR<NB, N> ifFalse
+) noexcept {
+    using S = SWAR<NB, uint64_t>;
+    return transformWords(
+        [](S c, S t, S f) {
+            return select(BooleanSWAR<NB, uint64_t>{c.value()}, t, f);
+        },
+        condition, ifTrue, ifFalse
+    );
+}
+
+}}
+
+#endif
@@ -0,0 +1,344 @@
+#ifndef ZOO_SWAR_ARITHMETIC_H
+#define ZOO_SWAR_ARITHMETIC_H
+
+/// \file arithmetic.h Lane-wise arithmetic that does not cross lanes:
+/// subtraction with flags, saturation, minimum and maximum, signed
+/// comparisons, average and absolute difference.
+///
+/// The lanes are interpreted as unsigned integers unless the name of the
+/// function says signed, the signed interpretation is two's complement.
+/// Like \c fullAddition, the functions clear the most significant bit of
+/// each lane before the arithmetic so that carries and borrows stay in the
+/// lane, and reintroduce it after.
+
+#include "zoo/swar/associative_iteration.h"
+
+#include <array>
+#include <utility>
+
+namespace zoo { namespace swar {
+
+/// \brief Subtraction that does not borrow across lanes, with the flags of
+/// unsigned borrow (carry) and signed overflow, the counterpart of
+/// \c fullAddition
+///
+/// Hacker's Delight, 2-18: the minuend with the MSB set can not borrow from
+/// the next lane, the MSB of the difference is the exclusive or of the MSBs
+/// of the operands and the borrow into the MSB.
+template<int NB, typename B>
+constexpr ArithmeticResultTriplet<NB, B>
+fullSubtraction(SWAR<NB, B> minuend, SWAR<NB, B> subtrahend) {
+    using S = SWAR<NB, B>;
+    using BS = BooleanSWAR<NB, B>;
+    constexpr auto SignBit = S{S::MostSignificantBit};
+    auto
+        differencePrime = (minuend | SignBit) - (subtrahend & S{S::LowerBits}),
+        result = differencePrime ^ ((minuend ^ ~subtrahend) & SignBit),
+        // the borrow out of the lane: Knuth's "x < y", see greaterEqual
+        borrow = SignBit & median(~minuend, subtrahend, result),
+        // overflow: the operands have different sign, the result does not
+        // have the sign of the minuend
+        overflow = (minuend ^ subtrahend) & (minuend ^ result) & SignBit;
+    return { result, BS{borrow.value()}, BS{overflow.value()} };
+}
+
+/// \brief Unsigned subtraction that results in 0 instead of borrowing
+template<int NB, typename B>
+constexpr SWAR<NB, B>
+saturatingUnsignedSubtraction(SWAR<NB, B> minuend, SWAR<NB, B> subtrahend) {
+    auto subtraction = fullSubtraction(minuend, subtrahend);
+    return subtraction.result & ~subtraction.carry.MSBtoLaneMask();
+}
+
+namespace impl {
+
+/// The lanes with \c overflow get the saturation value of the sign of
+/// \c signSource: the minimum for negative, maximum for positive
+template<int NB, typename B>
+constexpr SWAR<NB, B> saturateSigned(
+    SWAR<NB, B> result, BooleanSWAR<NB, B> overflow, SWAR<NB, B> signSource
+) {
+    using S = SWAR<NB, B>;
+    // LowerBits is the maximum, its complement in the lane the minimum
+    auto saturated = S{S::LowerBits} ^ makeLaneMaskFromMSB(signSource);
+    auto overflowMask = overflow.MSBtoLaneMask();
+    return (saturated & overflowMask) | (result & ~overflowMask);
+}
+
+}
+
+/// \brief Signed addition that results in the maximum or minimum instead of
+/// overflowing
+///
+/// Overflow only happens to operands of the same sign, and results in the
+/// extreme of that sign.
+template<int NB, typename B>
+constexpr SWAR<NB, B>
+saturatingSignedAddition(SWAR<NB, B> s1, SWAR<NB, B> s2) {
+    auto addition = fullAddition(s1, s2);
+    return impl::saturateSigned(addition.result, addition.overflow, s1);
+}
+
+/// \brief Signed subtraction that results in the maximum or minimum instead
+/// of overflowing
+///
+/// Overflow only happens to operands of different sign, and results in the
+/// extreme of the sign of the minuend.
+template<int NB, typename B>
+constexpr SWAR<NB, B>
+saturatingSignedSubtraction(SWAR<NB, B> minuend, SWAR<NB, B> subtrahend) {
+    auto subtraction = fullSubtraction(minuend, subtrahend);
+    return
+        impl::saturateSigned(subtraction.result, subtraction.overflow, minuend);
+}
+
+/// \brief The signed interpretation of \c greaterEqual
+///
+/// Flipping the sign bits maps the two's complement order to the unsigned
+/// order: the minimum, 10...0, becomes 0.
+template<int NB, typename B>
+constexpr BooleanSWAR<NB, B>
+signedGreaterEqual(SWAR<NB, B> left, SWAR<NB, B> right) noexcept {
+    using S = SWAR<NB, B>;
+    constexpr auto SignBit = S{S::MostSignificantBit};
+    return greaterEqual(left ^ SignBit, right ^ SignBit);
+}
+
+/// \brief The lanes of \c ifTrue where \c condition is true, of \c ifFalse
+/// otherwise
+template<int NB, typename B>
+constexpr SWAR<NB, B>
+select(BooleanSWAR<NB, B> condition, SWAR<NB, B> ifTrue, SWAR<NB, B> ifFalse) {
+    auto mask = condition.MSBtoLaneMask();
+    return (ifTrue & mask) | (ifFalse & ~mask);
+}
+
+template<int NB, typename B>
+constexpr SWAR<NB, B> maximum(SWAR<NB, B> a, SWAR<NB, B> b) {
+    return select(greaterEqual(a, b), a, b);
+}
+
+template<int NB, typename B>
+constexpr SWAR<NB, B> minimum(SWAR<NB, B> a, SWAR<NB, B> b) {
+    return select(greaterEqual(a, b), b, a);
+}
+
+template<int NB, typename B>
+constexpr SWAR<NB, B> signedMaximum(SWAR<NB, B> a, SWAR<NB, B> b) {
+    return select(signedGreaterEqual(a, b), a, b);
+}
+
+template<int NB, typename B>
+constexpr SWAR<NB, B> signedMinimum(SWAR<NB, B> a, SWAR<NB, B> b) {
+    return select(signedGreaterEqual(a, b), b, a);
+}
+
+/// \brief Average rounded up, <tt>(a + b + 1) / 2</tt> without overflow, as
+/// the instructions \c PAVGB and \c PAVGW of x86
+///
+/// <tt>a + b == 2*(a | b) - (a ^ b)</tt>; the bits shifted out of each lane
+/// are cleared first.  The subtraction does not borrow across lanes because
+/// <tt>(a ^ b) / 2 <= (a | b)</tt>.
+template<int NB, typename B>
+constexpr SWAR<NB, B> roundingAverage(SWAR<NB, B> a, SWAR<NB, B> b) {
+    using S = SWAR<NB, B>;
+    auto halfDifferences =
+        (a ^ b).shiftIntraLaneRight(1, S{S::LeastSignificantBit} ^ S{S::AllOnes});
+    return (a | b) - halfDifferences;
+}
+
+/// \brief <tt>|a - b|</tt> of the unsigned interpretation, which can not
+/// overflow
+template<int NB, typename B>
+constexpr SWAR<NB, B> absoluteDifference(SWAR<NB, B> a, SWAR<NB, B> b) {
+    auto aIsGreaterEqual = greaterEqual(a, b);
+    // the greater minus the lesser does not borrow
+    return select(aIsGreaterEqual, a, b) - select(aIsGreaterEqual, b, a);
+}
+
+namespace impl {
+
+/// \brief The lanes shifted right by \c count bits, without crossing lanes
+template<int NB, typename B>
+constexpr SWAR<NB, B> shiftLanesRightBits(SWAR<NB, B> input, int count) {
+    using S = SWAR<NB, B>;
+    if(0 == count) { return input; }
+    auto lowBits = S{B(S::LeastSignificantBit * ((B(1) << count) - 1))};
+    // the padding bits do not enter the most significant lane
+    return input.shiftIntraLaneRight(count, S{S::AllOnes} & ~lowBits);
+}
+
+/// \brief The constants to divide the unsigned integers of \c NB bits by a
+/// divisor with a multiplication and shifts
+///
+/// Granlund and Montgomery, "Division by Invariant Integers using
+/// Multiplication", 1994: if there is a multiplier of \c NB bits, \c simple,
+/// the quotient is <tt>mulhi(x, multiplier) >> shift</tt>, otherwise, with
+/// the multiplier of \c NB + 1 bits minus its most significant bit,
+/// <tt>t = mulhi(x, multiplier)</tt> and the quotient is
+/// <tt>(t + ((x - t) >> 1)) >> shift</tt>.
+struct DivisionMagic {
+    bool simple;
+    uint64_t multiplier;
+    int shift;
+};
+
+/// \pre \c divisor is not a power of two, and fits in \c NB bits
+template<int NB>
+constexpr DivisionMagic divisionMagic(uint64_t divisor) {
+    using Wide = __uint128_t;
+    auto log = meta::logCeiling(divisor);
+    auto laneModulo = Wide(1) << NB;
+    // a multiplier m = ceil(2^(NB + p) / divisor) gives exact quotients for
+    // all the dividends of NB bits if the error of rounding up,
+    // m * divisor - 2^(NB + p), is at most 2^p
+    for(auto p = 0; p <= log; ++p) {
+        auto power = Wide(1) << (NB + p);
+        auto m = (power + divisor - 1) / divisor;
+        if(m < laneModulo && m * divisor - power <= (Wide(1) << p)) {
+            return { true, uint64_t(m), p };
+        }
+    }
+    auto m = (Wide(1) << (NB + log)) / divisor - laneModulo + 1;
+    return { false, uint64_t(m), log - 1 };
+}
+
+}
+
+/// \brief Lane-wise quotient of the unsigned division by the constant
+/// \c Divisor, branch-free
+///
+/// Powers of two are shifts, other divisors multiply by a "magic number"
+/// derived at compile time for the lane width, see \c impl::DivisionMagic,
+/// with the widening multiplication of \c multiplicationHighHalf.
+/// \pre the lane count is even and the lanes can be doubled in precision,
+/// as required by \c doublePrecision
+template<uint64_t Divisor, int NB, typename B>
+constexpr SWAR<NB, B> divideByConstant(SWAR<NB, B> dividend) {
+    static_assert(0 < Divisor, "Division by 0");
+    using S = SWAR<NB, B>;
+    if constexpr(S::MaxUnsignedLaneValue < Divisor) {
+        return S{0};
+    } else if constexpr(0 == (Divisor & (Divisor - 1))) {
+        return impl::shiftLanesRightBits(dividend, meta::logFloor(Divisor));
+    } else {
+        constexpr auto Magic = impl::divisionMagic<NB>(Divisor);
+        auto high = multiplicationHighHalf(dividend, B(Magic.multiplier));
+        if constexpr(Magic.simple) {
+            return impl::shiftLanesRightBits(high, Magic.shift);
+        } else {
+            // neither the subtraction borrows nor the addition carries
+            auto halfDifference = impl::shiftLanesRightBits(dividend - high, 1);
+            return impl::shiftLanesRightBits(high + halfDifference, Magic.shift);
+        }
+    }
+}
+
+/// \brief Lane-wise remainder of the unsigned division by the constant
+/// \c Divisor
+///
+/// The product of each quotient by the divisor fits in its lane, thus the
+/// multiplication of the whole word does not carry across lanes.
+template<uint64_t Divisor, int NB, typename B>
+constexpr SWAR<NB, B> moduloByConstant(SWAR<NB, B> dividend) {
+    using S = SWAR<NB, B>;
+    if constexpr(S::MaxUnsignedLaneValue < Divisor) {
+        return dividend;
+    } else if constexpr(0 == (Divisor & (Divisor - 1))) {
+        return dividend & S{B(S::LeastSignificantBit * (Divisor - 1))};
+    } else {
+        auto quotient = divideByConstant<Divisor>(dividend);
+        return dividend - S{B(quotient.value() * Divisor)};
+    }
+}
+
+namespace impl {
+
+/// \brief The masks of the lanes whose multiplier has the canonical signed
+/// digit (CSD, also "non-adjacent form") +1, index 0, or -1, index 1, at
+/// each bit position
+///
+/// The CSD of a number has the minimum count of non-zero digits, at most
+/// half of the bits plus one, thus the minimum count of additions and
+/// subtractions of shifted multiplicands; 7 is 8 - 1 instead of 4 + 2 + 1.
+/// The digits of a lane of \c NB bits may reach the position \c NB.
+template<int NB, typename T>
+constexpr auto canonicalSignedDigitMasks(T multipliers) {
+    using S = SWAR<NB, T>;
+    std::array<std::array<T, 2>, NB + 1> rv{};
+    for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+        auto laneMask = T(S::LeastSignificantLaneMask << (lane * NB));
+        auto k = uint64_t(S{multipliers}.at(lane));
+        for(auto position = 0; k; ++position, k >>= 1) {
+            if(k & 1) {
+                // the remainder modulo 4 is 1 for +1, 3 for -1
+                auto negative = bool(k & 2);
+                rv[position][negative] |= laneMask;
+                k = negative ? k + 1 : k - 1;
+            }
+        }
+    }
+    return rv;
+}
+
+template<uint64_t Multipliers, int NB, typename T>
+struct CanonicalSignedDigits {
+    constexpr static auto Masks =
+        canonicalSignedDigitMasks<NB, T>(T(Multipliers));
+};
+
+template<typename CSD, std::size_t Position, int NB, typename T>
+constexpr void
+canonicalSignedDigitStep(SWAR<NB, T> &accumulator, SWAR<NB, T> x) {
+    using S = SWAR<NB, T>;
+    constexpr auto
+        Plus = CSD::Masks[Position][0],
+        Minus = CSD::Masks[Position][1];
+    if constexpr(0 != Plus) {
+        accumulator = accumulator + S{T((x & S{Plus}).value() << Position)};
+    }
+    if constexpr(0 != Minus) {
+        accumulator = accumulator - S{T((x & S{Minus}).value() << Position)};
+    }
+}
+
+template<typename CSD, int NB, typename T, std::size_t... Positions>
+constexpr SWAR<NB, T>
+canonicalSignedDigitChain(SWAR<NB, T> x, std::index_sequence<Positions...>) {
+    SWAR<NB, T> rv{0};
+    (canonicalSignedDigitStep<CSD, Positions>(rv, x), ...);
+    return rv;
+}
+
+}
+
+/// \brief Multiplication of each lane by its multiplier in the constant
+/// \c Multipliers, with a chain of shifts, additions and subtractions
+/// generated at compile time
+///
+/// The multiplicands of the lanes with a non-zero canonical signed digit at
+/// a position are selected, shifted as a whole and added or subtracted, see
+/// \c impl::canonicalSignedDigitMasks.  The result is the exact sum of the
+/// products shifted to their lanes, like \c multiplication_OverflowUnsafe:
+/// a product that does not fit in its lane corrupts the more significant
+/// lanes.  Multiplying all the lanes by the same multiplier is a single
+/// multiplication of the whole word.
+/// \tparam Multipliers the multipliers of the lanes, laid out as the lanes
+/// of \c SWAR<NB, T>
+template<uint64_t Multipliers, int NB, typename T>
+constexpr SWAR<NB, T> constantMultiplication_OverflowUnsafe(SWAR<NB, T> x) {
+    using S = SWAR<NB, T>;
+    constexpr auto Lane0 = T(Multipliers & S::LeastSignificantLaneMask);
+    if constexpr(T(Multipliers) == T(Lane0 * S::LeastSignificantBit)) {
+        // the padding bits would be multiplied into the lanes
+        return S{T((x & S{S::AllOnes}).value() * Lane0)};
+    } else {
+        return impl::canonicalSignedDigitChain<
+            impl::CanonicalSignedDigits<Multipliers, NB, T>
+        >(x, std::make_index_sequence<NB + 1>{});
+    }
+}
+
+}}
+
+#endif
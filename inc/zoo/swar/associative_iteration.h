@@ -2,6 +2,11 @@
 #define ZOO_SWAR_ASSOCIATIVE_ITERATION_H
 
 #include "zoo/swar/SWAR.h"
+#include "zoo/pp/platform.h"
+
+#if ZOO_CONFIGURED_TO_USE_BMI() || ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+#include <immintrin.h>
+#endif
 
 //#define ZOO_DEVELOPMENT_DEBUGGING
 #ifdef ZOO_DEVELOPMENT_DEBUGGING
@@ -139,9 +144,47 @@ then, we only keep positions that move an even number of positions.
 Now, we will repeat these steps but for groups of two zeroes, then 4 zeroes, ...
 */
 
+namespace impl {
+
+#if ZOO_CONFIGURED_TO_USE_BMI() || ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+/// \brief The BMI2 instructions PEXT and PDEP applied to each lane
+/// \tparam Deposit PDEP if true, otherwise PEXT
+template<int NB, bool Deposit>
+ZOO_TARGET("bmi2")
+uint64_t lanewiseBMI2(uint64_t input, uint64_t mask) noexcept {
+    using S = SWAR<NB, uint64_t>;
+    if constexpr(64 == NB) {
+        return Deposit ? _pdep_u64(input, mask) : _pext_u64(input, mask);
+    } else {
+        uint64_t rv = 0;
+        for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+            auto shift = lane * NB;
+            auto laneInput = (input >> shift) & S::LeastSignificantLaneMask;
+            auto laneMask = (mask >> shift) & S::LeastSignificantLaneMask;
+            auto processed =
+                Deposit ?
+                    _pdep_u64(laneInput, laneMask) :
+                    _pext_u64(laneInput, laneMask);
+            rv |= processed << shift;
+        }
+        return rv;
+    }
+}
+#endif
+
+/// The SWAR algorithms of \c compress and \c expand take a number of steps
+/// logarithmic in the lane width, one BMI2 instruction per lane is faster
+/// only for lanes of at least this width, see benchmark/swar/compress.cpp
+constexpr auto MinimumLaneWidthForBMI2 = 8;
+
+template<int NB, typename B>
+constexpr auto UseLanewiseBMI2 =
+    ZOO_CONFIGURED_TO_USE_BMI() && std::is_same_v<B, uint64_t> &&
+    MinimumLaneWidthForBMI2 <= NB;
+
 template<int NB, typename B>
 constexpr SWAR<NB, B>
-compress(SWAR<NB, B> input, SWAR<NB, B> compressionMask) {
+compressWithParallelSuffix(SWAR<NB, B> input, SWAR<NB, B> compressionMask) {
     // This solution uses the parallel suffix operation as a primary tool:
     // For every bit postion it indicates an odd number of ones to the right,
     // including itself.
@@ -203,6 +246,98 @@ compress(SWAR<NB, B> input, SWAR<NB, B> compressionMask) {
     return result;
 }
 
+}
+
+/// \brief Equivalent to the BMI2 instruction PEXT applied to each lane, see
+/// the explanation of the algorithm above
+template<int NB, typename B>
+constexpr SWAR<NB, B>
+compress(SWAR<NB, B> input, SWAR<NB, B> compressionMask) {
+    #if ZOO_CONFIGURED_TO_USE_BMI()
+    if constexpr(impl::UseLanewiseBMI2<NB, B>) {
+        if(!__builtin_is_constant_evaluated()) {
+            return SWAR<NB, B>{
+                impl::lanewiseBMI2<NB, false>(
+                    input.value(), compressionMask.value()
+                )
+            };
+        }
+    }
+    #endif
+    return impl::compressWithParallelSuffix(input, compressionMask);
+}
+
+namespace impl {
+
+/// The algorithm, also from Hacker's Delight, calculates the same moves of
+/// \c compress, by moving the bits of the mask, and then does them in
+/// reverse order and direction to the input.  Because a bit that moves
+/// \c groupSize to the left during expansion is at least at \c groupSize
+/// within its lane, the moves do not need intra lane masks.
+template<int NB, typename B>
+constexpr SWAR<NB, B>
+expandWithParallelSuffix(SWAR<NB, B> input, SWAR<NB, B> expansionMask) {
+    using S = SWAR<NB, B>;
+    constexpr auto Steps = meta::logCeiling(NB);
+    S moves[Steps == 0 ? 1 : Steps] = {};
+    auto mask = expansionMask;
+    auto groupSize = 1;
+    auto
+        shiftLeftMask = S{S::LowerBits},
+        shiftRightMask = S{S::LowerBits << 1};
+    // see compress
+    auto forParallelSuffix =
+        (~mask).shiftIntraLaneLeft(groupSize, shiftLeftMask);
+    for(auto step = 0; step < Steps; ++step) {
+        auto oddCountOfGroupsOfZerosToTheRight =
+            parallelSuffix(forParallelSuffix);
+        auto moving = mask & oddCountOfGroupsOfZerosToTheRight;
+        moves[step] = moving;
+        mask =
+            (mask ^ moving) |
+            moving.shiftIntraLaneRight(groupSize, shiftRightMask);
+        forParallelSuffix =
+            forParallelSuffix & ~oddCountOfGroupsOfZerosToTheRight;
+        auto newShiftLeftMask =
+            shiftLeftMask.shiftIntraLaneRight(groupSize, shiftRightMask);
+        shiftRightMask =
+            shiftRightMask.shiftIntraLaneLeft(groupSize, shiftLeftMask);
+        shiftLeftMask = newShiftLeftMask;
+        groupSize <<= 1;
+    }
+    auto result = input;
+    for(auto step = Steps; step--; ) {
+        groupSize >>= 1;
+        auto moving = moves[step];
+        auto moved = S{B(result.value() << groupSize)} & moving;
+        result = (result & ~moving) | moved;
+    }
+    return result & expansionMask;
+}
+
+}
+
+/// \brief The inverse of \c compress, equivalent to the BMI2 instruction
+/// PDEP of "Parallel Deposit": the least significant bits of each lane of
+/// the input are put, in order, in the positions of the bits set in the
+/// same lane of the mask, the other bits of the result are 0.
+template<int NB, typename B>
+constexpr SWAR<NB, B>
+expand(SWAR<NB, B> input, SWAR<NB, B> expansionMask) {
+    #if ZOO_CONFIGURED_TO_USE_BMI()
+    if constexpr(impl::UseLanewiseBMI2<NB, B>) {
+        if(!__builtin_is_constant_evaluated()) {
+            return SWAR<NB, B>{
+                impl::lanewiseBMI2<NB, true>(
+                    input.value(), expansionMask.value()
+                )
+            };
+        }
+    }
+    #endif
+    return impl::expandWithParallelSuffix(input, expansionMask);
+}
+
 /// \todo because of the desirability of "accumuating" the XORs at the MSB,
 /// the parallel suffix operation is more suitable.
 template<int NB, typename B>
@@ -235,7 +370,7 @@ template<int NB, typename B>
 constexpr auto makeLaneMaskFromMSB(SWAR<NB, B> input) {
     using S = SWAR<NB, B>;
     auto msb = input & S{S::MostSignificantBit};
-    auto msbCopiedToLSB = S{msb.value() >> (NB - 1)};
+    auto msbCopiedToLSB = S{B(msb.value() >> (NB - 1))};
     return impl::makeLaneMaskFromMSB_and_LSB(msb, msbCopiedToLSB);
 }
 
@@ -394,10 +529,10 @@ constexpr auto multiplication_OverflowUnsafe_SpecificBitCount(
 
     auto halver = [](auto counts) {
         auto msbCleared = counts & ~S{S::MostSignificantBit};
-        return S{msbCleared.value() << 1};
+        return S{T(msbCleared.value() << 1)};
     };
 
-    auto shifted = S{multiplier.value() << (NB - ActualBits)};
+    auto shifted = S{T(multiplier.value() << (NB - ActualBits))};
     return associativeOperatorIterated_regressive(
         multiplicand, S{0}, shifted, S{S::MostSignificantBit}, operation,
         ActualBits, halver
@@ -450,7 +585,7 @@ constexpr auto exponentiation_OverflowUnsafe_SpecificBitCount(
     exponent = S{static_cast<T>(exponent.value() << (NB - ActualBits))};
     return associativeOperatorIterated_regressive(
         x,
-        S{meta::BitmaskMaker<T, 1, NB>().value}, // neutral is lane wise..
+        S{S::LeastSignificantBit}, // neutral is lane wise..
         exponent,
         S{S::MostSignificantBit},
         operation,
@@ -494,7 +629,7 @@ constexpr auto doublePrecision(SWAR<NB, T> input) {
     constexpr auto DM = doublingMask<NB, T>();
     return SWAR_Pair<NB * 2, T>{
         RV{(input & DM).value()},
-        RV{(input.value() >> NB) & DM.value()}
+        RV{T((input.value() >> NB) & DM.value())}
     };
 }
 
@@ -506,10 +641,90 @@ constexpr auto halvePrecision(SWAR<NB, T> even, SWAR<NB, T> odd) {
     constexpr auto HalvingMask = doublingMask<NB/2, T>();
     auto
         evenHalf = RV{even.value()} & HalvingMask,
-        oddHalf = RV{(RV{odd.value()} & HalvingMask).value() << NB/2};
+        oddHalf = RV{T((RV{odd.value()} & HalvingMask).value() << NB/2)};
     return evenHalf | oddHalf;
 }
 
+/// \brief The exact products of the lanes, interpreted as unsigned integers,
+/// in lanes of double the width: the products of the even lanes in \c even,
+/// of the odd lanes in \c odd
+///
+/// The operands are widened with \c doublePrecision, then multiplied with
+/// the multiplication of only the bits of the original width, the products
+/// and the partial sums fit in the doubled lanes.
+template<int NB, typename T>
+constexpr auto wideningMultiplication(
+    SWAR<NB, T> multiplicand, SWAR<NB, T> multiplier
+) {
+    using D = SWAR<NB * 2, T>;
+    auto
+        wideMultiplicand = doublePrecision(multiplicand),
+        wideMultiplier = doublePrecision(multiplier);
+    auto multiply = [](D left, D right) {
+        if constexpr(1 == D::Lanes) {
+            // the native multiplication is exact
+            return D{T(left.value() * right.value())};
+        } else {
+            return multiplication_OverflowUnsafe_SpecificBitCount<NB>(left, right);
+        }
+    };
+    return SWAR_Pair<NB * 2, T>{
+        multiply(wideMultiplicand.even, wideMultiplier.even),
+        multiply(wideMultiplicand.odd, wideMultiplier.odd)
+    };
+}
+
+/// \brief \c wideningMultiplication of all the lanes by the same multiplier
+/// \pre \c multiplier fits in a lane
+///
+/// The products of the widened lanes by a multiplier of the original width
+/// fit in the doubled lanes, then the native multiplication of the whole
+/// word does not carry across lanes.
+template<int NB, typename T>
+constexpr auto wideningMultiplication(
+    SWAR<NB, T> multiplicand, typename SWAR<NB, T>::type multiplier
+) {
+    using D = SWAR<NB * 2, T>;
+    auto wide = doublePrecision(multiplicand);
+    auto multiply = [=](D lanes) { return D{T(lanes.value() * multiplier)}; };
+    return SWAR_Pair<NB * 2, T>{multiply(wide.even), multiply(wide.odd)};
+}
+
+namespace impl {
+
+template<int NB, typename T>
+constexpr auto highHalves(SWAR_Pair<NB * 2, T> products) {
+    using D = SWAR<NB * 2, T>;
+    auto highHalf = [](D product) { return D{T(product.value() >> NB)}; };
+    return halvePrecision(highHalf(products.even), highHalf(products.odd));
+}
+
+}
+
+/// \brief The most significant half of the exact products of the lanes,
+/// interpreted as unsigned integers
+///
+/// The least significant halves are <tt>halvePrecision(products.even,
+/// products.odd)</tt> of the \c wideningMultiplication, which, unlike
+/// \c multiplication_OverflowUnsafe, do not corrupt other lanes.
+template<int NB, typename T>
+constexpr auto multiplicationHighHalf(
+    SWAR<NB, T> multiplicand, SWAR<NB, T> multiplier
+) {
+    return
+        impl::highHalves<NB, T>(wideningMultiplication(multiplicand, multiplier));
+}
+
+/// \brief \c multiplicationHighHalf of all the lanes by the same multiplier
+/// \pre \c multiplier fits in a lane
+template<int NB, typename T>
+constexpr auto multiplicationHighHalf(
+    SWAR<NB, T> multiplicand, typename SWAR<NB, T>::type multiplier
+) {
+    return
+        impl::highHalves<NB, T>(wideningMultiplication(multiplicand, multiplier));
+}
+
 }
 
 #endif
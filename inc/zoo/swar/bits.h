@@ -0,0 +1,149 @@
+#ifndef ZOO_SWAR_BITS_H
+#define ZOO_SWAR_BITS_H
+
+/// \file bits.h Counts and permutations of the bits of each lane: count of
+/// leading and trailing zeros, population count, reversal of the bits and
+/// of the bytes.
+///
+/// The lanes must have a width power of two, the same as \c logarithmFloor.
+
+#include "zoo/swar/arithmetic.h"
+
+namespace zoo { namespace swar {
+
+namespace impl {
+
+template<int NB>
+constexpr auto LogOfLaneWidth = meta::logFloor(NB);
+
+template<int NB>
+constexpr void assertLaneWidthIsPowerOfTwo() {
+    static_assert(
+        NB == (1 << LogOfLaneWidth<NB>),
+        "Only lanes of a width power of two are supported"
+    );
+}
+
+/// \brief Replaces each group of twice \c HalfSize bits with the sum of
+/// its halves, then the groups of double the size, until the lanes
+template<int HalfSize, int NB, typename T>
+constexpr SWAR<NB, T> addHalvesOfGroups(SWAR<NB, T> input) {
+    if constexpr(NB <= HalfSize) {
+        return input;
+    } else {
+        constexpr auto Mask =
+            meta::BitmaskMaker<T, T((T(1) << HalfSize) - 1), 2 * HalfSize>::value;
+        auto v = input.value();
+        auto added = T((v & Mask) + ((v >> HalfSize) & Mask));
+        return addHalvesOfGroups<2 * HalfSize>(SWAR<NB, T>{added});
+    }
+}
+
+/// \brief Copies the bits set to the \c Shift, then twice \c Shift...
+/// less significant positions of their lane, until all the less significant
+/// positions are set
+template<int Shift, int NB, typename T>
+constexpr SWAR<NB, T> copyBitsDownward(SWAR<NB, T> input) {
+    if constexpr(NB <= Shift) {
+        return input;
+    } else {
+        // clears the bits shifted from the next lane
+        constexpr auto Mask =
+            meta::BitmaskMaker<T, T((T(1) << (NB - Shift)) - 1), NB>::value;
+        auto v = input.value();
+        return copyBitsDownward<2 * Shift>(SWAR<NB, T>{T(v | ((v >> Shift) & Mask))});
+    }
+}
+
+/// \brief Exchanges the halves of the groups of bits of each size, from
+/// twice \c HalfSize until the size of the lanes
+///
+/// Each step doubles the size of the groups, the groups divide the lanes,
+/// thus the exchanges do not cross lanes.
+template<int HalfSize, int NB, typename T>
+constexpr SWAR<NB, T> exchangeHalvesOfGroups(SWAR<NB, T> input) {
+    if constexpr(NB <= HalfSize) {
+        return input;
+    } else {
+        // the lower halves of the groups
+        constexpr auto Mask =
+            meta::BitmaskMaker<T, T((T(1) << HalfSize) - 1), 2 * HalfSize>::value;
+        auto v = input.value();
+        auto exchanged = T(((v >> HalfSize) & Mask) | ((v & Mask) << HalfSize));
+        return exchangeHalvesOfGroups<2 * HalfSize>(SWAR<NB, T>{exchanged});
+    }
+}
+
+}
+
+/// \brief Count of bits set in each lane
+///
+/// The counts of the halves of the groups of bits are added in place, from
+/// groups of 2 bits to the lane, a linear count of steps in the logarithm of
+/// the width, unlike \c meta::PopcountLogic, which recurses into both
+/// halves.
+template<int NB, typename T>
+constexpr SWAR<NB, T> popcountLanes(SWAR<NB, T> input) {
+    impl::assertLaneWidthIsPowerOfTwo<NB>();
+    return impl::addHalvesOfGroups<1>(input);
+}
+
+/// \brief Count of leading zeros in each lane, the lane width for 0
+///
+/// The most significant bit set is copied to all the less significant bits
+/// in the lane, what remains are the leading zeros.
+template<int NB, typename T>
+constexpr SWAR<NB, T> clzLanes(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    impl::assertLaneWidthIsPowerOfTwo<NB>();
+    auto smeared = impl::copyBitsDownward<1>(input);
+    // the width does not borrow, it is greater or equal to any count
+    return S{T(S::LeastSignificantBit * NB)} - popcountLanes(smeared);
+}
+
+/// \brief Count of trailing zeros in each lane, the lane width for 0
+///
+/// <tt>~x & (x - 1)</tt> sets the trailing zeros and clears the rest, the
+/// subtraction does not borrow across lanes.
+template<int NB, typename T>
+constexpr SWAR<NB, T> ctzLanes(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    impl::assertLaneWidthIsPowerOfTwo<NB>();
+    auto decremented =
+        fullSubtraction(input, S{S::LeastSignificantBit}).result;
+    return popcountLanes(~input & decremented);
+}
+
+/// \brief The bits of each lane in reverse order
+template<int NB, typename T>
+constexpr SWAR<NB, T> reverseBitsInLanes(SWAR<NB, T> input) {
+    impl::assertLaneWidthIsPowerOfTwo<NB>();
+    return impl::exchangeHalvesOfGroups<1>(input);
+}
+
+/// \brief The bytes of each lane in reverse order
+///
+/// Lanes of the width of the type use the byte swap of the compiler.
+template<int NB, typename T>
+constexpr SWAR<NB, T> byteSwapLanes(SWAR<NB, T> input) {
+    impl::assertLaneWidthIsPowerOfTwo<NB>();
+    static_assert(0 == NB % 8, "The lanes must have whole bytes");
+    #ifndef _MSC_VER
+    if constexpr(sizeof(T) * 8 == NB && 8 < NB) {
+        if constexpr(16 == NB) {
+            return SWAR<NB, T>{__builtin_bswap16(input.value())};
+        } else if constexpr(32 == NB) {
+            return SWAR<NB, T>{__builtin_bswap32(input.value())};
+        } else {
+            return SWAR<NB, T>{T(__builtin_bswap64(input.value()))};
+        }
+    } else
+    #endif
+    {
+        return impl::exchangeHalvesOfGroups<8>(input);
+    }
+}
+
+}}
+
+#endif
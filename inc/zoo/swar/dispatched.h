@@ -0,0 +1,67 @@
+#ifndef ZOO_SWAR_DISPATCHED_H
+#define ZOO_SWAR_DISPATCHED_H
+
+/// \file dispatched.h SWAR operations that use the instruction set
+/// extensions the processor supports, selected at run time.
+///
+/// A program built for the baseline x86-64 uses the extensions in the
+/// functions compiled for them with \c ZOO_TARGET, and \c Dispatched selects
+/// them after checking the processor.  NEON is part of the aarch64 baseline,
+/// it does not need dispatch.
+
+#include "zoo/swar/associative_iteration.h"
+#include "zoo/root/cpu.h"
+
+namespace zoo { namespace swar {
+
+namespace impl {
+
+template<int NB, bool Deposit>
+uint64_t lanewiseSWAR(uint64_t input, uint64_t mask) noexcept {
+    using S = SWAR<NB, uint64_t>;
+    auto rv =
+        Deposit ?
+            expandWithParallelSuffix(S{input}, S{mask}) :
+            compressWithParallelSuffix(S{input}, S{mask});
+    return rv.value();
+}
+
+template<int NB, bool Deposit>
+struct LanewiseResolver {
+    static auto resolve([[maybe_unused]] const CPUFeatures &features) noexcept {
+        #if ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+            if(features.bmi2 && MinimumLaneWidthForBMI2 <= NB) {
+                return lanewiseBMI2<NB, Deposit>;
+            }
+        #endif
+        return lanewiseSWAR<NB, Deposit>;
+    }
+};
+
+template<int NB, bool Deposit>
+SWAR<NB, uint64_t>
+lanewiseDispatched(SWAR<NB, uint64_t> input, SWAR<NB, uint64_t> mask) noexcept {
+    using D =
+        Dispatched<LanewiseResolver<NB, Deposit>, uint64_t(uint64_t, uint64_t)>;
+    return SWAR<NB, uint64_t>{D::call(input.value(), mask.value())};
+}
+
+}
+
+/// \brief \c compress with the implementation selected at run time
+template<int NB>
+SWAR<NB, uint64_t>
+compressDispatched(SWAR<NB, uint64_t> input, SWAR<NB, uint64_t> mask) noexcept {
+    return impl::lanewiseDispatched<NB, false>(input, mask);
+}
+
+/// \brief \c expand with the implementation selected at run time
+template<int NB>
+SWAR<NB, uint64_t>
+expandDispatched(SWAR<NB, uint64_t> input, SWAR<NB, uint64_t> mask) noexcept {
+    return impl::lanewiseDispatched<NB, true>(input, mask);
+}
+
+}}
+
+#endif
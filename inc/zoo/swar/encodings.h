@@ -0,0 +1,379 @@
+#ifndef ZOO_SWAR_ENCODINGS_H
+#define ZOO_SWAR_ENCODINGS_H
+
+/*! \file encodings.h
+\brief Hexadecimal and base64, RFC 4648, encoding and decoding of 8 bytes
+at a time
+
+The bits of the input are spread to, or gathered from, the lanes of the
+output with \c expand and \c compress: the nibbles of 4 bytes to 8 lanes of
+bytes, the sextets of 6 bytes to 8 lanes.  The lanes are converted to and
+from characters with lane-wise comparisons and additions of the offsets of
+the ranges of characters.  The decoders validate all the characters with
+the same comparisons, the errors are accumulated and tested once at the end.
+
+The inputs are loaded, and the outputs stored, with \c memcpy of whole
+words, the bytes before the end of the range and after the last whole word
+are copied to a padded word.
+*/
+
+#include "zoo/swar/bits.h"
+#include "zoo/swar/ranges.h"
+
+namespace zoo { namespace swar {
+
+/// The result of the decoders for invalid inputs
+constexpr auto InvalidEncoding = ~std::size_t(0);
+
+namespace impl {
+
+/// The least significant \c From bits of each lane of \c To bits
+template<int From, int To>
+constexpr auto FieldMask =
+    meta::BitmaskMaker<uint64_t, (uint64_t(1) << From) - 1, To>::value;
+
+/// \brief The fields of \c From bits of \c v to the lanes of \c To bits,
+/// the upper halves of groups of \c BlockFields fields moved up first
+template<int From, int To, int BlockFields>
+constexpr uint64_t spreadFields(uint64_t v) noexcept {
+    if constexpr(0 == BlockFields) {
+        return v;
+    } else {
+        constexpr auto In = BlockFields * From, Out = BlockFields * To;
+        constexpr auto Upper =
+            meta::BitmaskMaker<
+                uint64_t, ((uint64_t(1) << In) - 1) << In, 2 * Out
+            >::value;
+        v = (v & ~Upper) | ((v & Upper) << (Out - In));
+        return spreadFields<From, To, BlockFields / 2>(v);
+    }
+}
+
+/// \brief The inverse of \c spreadFields
+template<int From, int To, int BlockFields>
+constexpr uint64_t gatherFields(uint64_t v) noexcept {
+    if constexpr(64 / To <= BlockFields) {
+        return v;
+    } else {
+        constexpr auto In = BlockFields * From, Out = BlockFields * To;
+        constexpr auto Upper =
+            meta::BitmaskMaker<
+                uint64_t, ((uint64_t(1) << In) - 1) << Out, 2 * Out
+            >::value;
+        v = (v & ~Upper) | ((v & Upper) >> (Out - In));
+        return gatherFields<From, To, 2 * BlockFields>(v);
+    }
+}
+
+/// \brief \c expand of the least significant fields of \c From bits of
+/// \c v to the lanes of \c To bits
+///
+/// Without BMI2, \c expand takes a logarithmic count of parallel suffixes to
+/// move the bits of any mask; the mask is constant here, a logarithmic count
+/// of shifts does.
+template<int From, int To>
+constexpr uint64_t expandFields(uint64_t v) noexcept {
+    if constexpr(UseLanewiseBMI2<64, uint64_t>) {
+        using S = SWAR<64, uint64_t>;
+        return expand(S{v}, S{FieldMask<From, To>}).value();
+    } else {
+        return spreadFields<From, To, 64 / To / 2>(v);
+    }
+}
+
+/// \brief \c compress of the least significant \c From bits of the lanes
+/// of \c To bits of \c v, see \c expandFields
+template<int From, int To>
+constexpr uint64_t compressFields(uint64_t v) noexcept {
+    if constexpr(UseLanewiseBMI2<64, uint64_t>) {
+        using S = SWAR<64, uint64_t>;
+        return compress(S{v}, S{FieldMask<From, To>}).value();
+    } else {
+        return gatherFields<From, To, 1>(v & FieldMask<From, To>);
+    }
+}
+
+/// \brief The lanes at least \c Minimum
+/// \pre the lanes are less than 0x80
+template<unsigned Minimum>
+constexpr ByteBooleans atLeast(uint64_t bytes) noexcept {
+    constexpr auto Ones = ByteLanes::LeastSignificantBit;
+    return ByteBooleans{
+        (bytes + Ones * (0x80 - Minimum)) & ByteLanes::MostSignificantBit
+    };
+}
+
+/// \brief The lanes in <tt>[Low, High]</tt>
+/// \pre the lanes are less than 0x80
+template<unsigned Low, unsigned High>
+constexpr ByteBooleans inRange(uint64_t bytes) noexcept {
+    return atLeast<Low>(bytes) & ~atLeast<High + 1>(bytes);
+}
+
+/// \brief Lane-wise sum of \c bytes and the offsets, modulo 256
+/// \pre the lanes of \c bytes are less than 0x80
+constexpr uint64_t addOffsets(uint64_t bytes, uint64_t offsets) noexcept {
+    constexpr auto HighBits = ByteLanes::MostSignificantBit;
+    return (bytes + (offsets & ~HighBits)) ^ (offsets & HighBits);
+}
+
+/// \brief The 8 lowercase hexadecimal digits of the 4 least significant
+/// bytes of \c bytes, in the order of the bytes in memory
+constexpr uint64_t hexDigits(uint64_t bytes) noexcept {
+    constexpr auto Ones = ByteLanes::LeastSignificantBit;
+    constexpr uint64_t LowNibbles = 0x0F0F'0F0F;
+    // the most significant nibble of each byte goes first
+    auto swapped = ((bytes >> 4) & LowNibbles) | ((bytes & LowNibbles) << 4);
+    auto nibbles = expandFields<4, 8>(swapped);
+    auto letters = atLeast<10>(nibbles).value() >> 7;
+    return nibbles + Ones * '0' + letters * ('a' - '0' - 10);
+}
+
+/// \brief The 4 bytes of the 8 hexadecimal digits in \c characters,
+/// lowercase or uppercase, the lanes that are not digits are set in
+/// \c errors
+constexpr uint64_t
+hexValues(uint64_t characters, uint64_t &errors) noexcept {
+    constexpr auto
+        Ones = ByteLanes::LeastSignificantBit,
+        HighBits = ByteLanes::MostSignificantBit;
+    auto ascii = characters & ~HighBits;
+    auto digits =
+        inRange<'0', '9'>(ascii) | inRange<'a', 'f'>(ascii | Ones * 0x20);
+    errors |= (characters | ~digits.value()) & HighBits;
+    // the letters have the bit 6 set and their low nibble is 1 to 6
+    auto nibbles =
+        (characters & (Ones * 0x0F)) + ((characters >> 6) & Ones) * 9;
+    // the first nibble of each pair, in the lower byte, is the upper nibble
+    auto pairs = (nibbles >> 8) | (nibbles << 4);
+    return compressFields<8, 16>(pairs);
+}
+
+/// \brief The big endian 48 bits of the 6 least significant bytes of
+/// \c bytes, in the order of the bytes in memory, as 8 characters of base64
+constexpr uint64_t base64Characters(uint64_t bytes) noexcept {
+    constexpr auto Ones = ByteLanes::LeastSignificantBit;
+    using Word = SWAR<64, uint64_t>;
+    auto bigEndian = byteSwapLanes(Word{bytes}).value() >> 16;
+    // the sextets from the last, the swap puts them in order
+    auto sextets = byteSwapLanes(Word{expandFields<6, 8>(bigEndian)}).value();
+    // the offset from the sextet to the character changes at the first
+    // sextet of each range, the lanes of 1 multiply the changes
+    constexpr auto offset = [](int character, int sextet) {
+        return uint8_t(character - sextet);
+    };
+    constexpr auto
+        Upper = offset('A', 0), Lower = offset('a', 26),
+        Digit = offset('0', 52), Plus = offset('+', 62),
+        Slash = offset('/', 63);
+    auto ones = [](ByteBooleans b) { return b.value() >> 7; };
+    auto offsets =
+        Ones * Upper ^
+        ones(atLeast<26>(sextets)) * (Upper ^ Lower) ^
+        ones(atLeast<52>(sextets)) * (Lower ^ Digit) ^
+        ones(atLeast<62>(sextets)) * (Digit ^ Plus) ^
+        ones(atLeast<63>(sextets)) * (Plus ^ Slash);
+    return addOffsets(sextets, offsets);
+}
+
+/// \brief The 6 bytes of the 8 characters of base64 in \c characters, the
+/// lanes that are not of the alphabet are set in \c errors
+///
+/// The ranges of the alphabet in ascending order are '+', '/', the digits,
+/// the uppercase and the lowercase letters: the comparisons with the first
+/// characters give the offsets and, with the comparisons with the
+/// characters after the last, the validity.
+constexpr uint64_t
+base64Values(uint64_t characters, uint64_t &errors) noexcept {
+    constexpr auto
+        Ones = ByteLanes::LeastSignificantBit,
+        HighBits = ByteLanes::MostSignificantBit;
+    auto ascii = characters & ~HighBits;
+    auto
+        fromPlus = atLeast<'+'>(ascii), fromSlash = atLeast<'/'>(ascii),
+        fromDigit = atLeast<'0'>(ascii), fromUpper = atLeast<'A'>(ascii),
+        fromLower = atLeast<'a'>(ascii);
+    auto alphabet =
+        (fromPlus & ~atLeast<'+' + 1>(ascii)) |
+        (fromSlash & ~atLeast<'9' + 1>(ascii)) |
+        (fromUpper & ~atLeast<'Z' + 1>(ascii)) |
+        (fromLower & ~atLeast<'z' + 1>(ascii));
+    errors |= (characters | ~alphabet.value()) & HighBits;
+    // the offsets to add, modulo 256, see base64Characters
+    constexpr auto offset = [](int character, int sextet) {
+        return uint8_t(sextet - character);
+    };
+    constexpr auto
+        Plus = offset('+', 62), Slash = offset('/', 63),
+        Digit = offset('0', 52), Upper = offset('A', 0),
+        Lower = offset('a', 26);
+    auto ones = [](ByteBooleans b) { return b.value() >> 7; };
+    auto offsets =
+        Ones * Plus ^
+        ones(fromSlash) * (Plus ^ Slash) ^ ones(fromDigit) * (Slash ^ Digit) ^
+        ones(fromUpper) * (Digit ^ Upper) ^ ones(fromLower) * (Upper ^ Lower);
+    auto sextets = addOffsets(ascii, offsets);
+    using Word = SWAR<64, uint64_t>;
+    auto bigEndian =
+        compressFields<6, 8>(byteSwapLanes(Word{sextets}).value());
+    return byteSwapLanes(Word{bigEndian << 16}).value();
+}
+
+}
+
+/// \brief The count of characters of the hexadecimal encoding of \c size
+/// bytes
+constexpr std::size_t hexEncodedSize(std::size_t size) noexcept {
+    return 2 * size;
+}
+
+/// \brief Writes the lowercase hexadecimal digits of \c input to \c output,
+/// returns the count written
+/// \pre \c output has room for <tt>hexEncodedSize(input.size())</tt>
+inline std::size_t encodeHex(ByteSpan input, MutableByteSpan output) noexcept {
+    constexpr auto BlockSize = sizeof(uint64_t);
+    auto source = input.data();
+    auto destination = output.data();
+    auto encode = [&](uint64_t bytes, std::size_t count) {
+        uint64_t digits[] = {
+            impl::hexDigits(bytes), impl::hexDigits(bytes >> 32)
+        };
+        memcpy(destination, digits, 2 * count);
+        destination += 2 * count;
+    };
+    auto end = input.end();
+    for(; BlockSize <= std::size_t(end - source); source += BlockSize) {
+        uint64_t bytes;
+        memcpy(&bytes, source, BlockSize);
+        encode(bytes, BlockSize);
+    }
+    if(source != end) {
+        uint64_t bytes = 0;
+        memcpy(&bytes, source, end - source);
+        encode(bytes, end - source);
+    }
+    return hexEncodedSize(input.size());
+}
+
+/// \brief Writes the bytes of the hexadecimal digits of \c input, lowercase
+/// or uppercase, to \c output, returns the count written, or
+/// \c InvalidEncoding for odd counts of digits or characters that are not
+/// digits
+/// \pre \c output has room for half the size of \c input
+/// \note For invalid inputs the contents of \c output are unspecified
+inline std::size_t decodeHex(ByteSpan input, MutableByteSpan output) noexcept {
+    if(input.size() % 2) { return InvalidEncoding; }
+    constexpr auto BlockSize = 2 * sizeof(uint64_t);
+    auto source = input.data();
+    auto destination = output.data();
+    uint64_t errors = 0;
+    auto decode = [&](const uint64_t (&characters)[2], std::size_t count) {
+        auto bytes =
+            impl::hexValues(characters[0], errors) |
+            (impl::hexValues(characters[1], errors) << 32);
+        memcpy(destination, &bytes, count / 2);
+        destination += count / 2;
+    };
+    auto end = input.end();
+    for(; BlockSize <= std::size_t(end - source); source += BlockSize) {
+        uint64_t characters[2];
+        memcpy(characters, source, BlockSize);
+        decode(characters, BlockSize);
+    }
+    if(source != end) {
+        constexpr auto Zeros = ByteLanes::LeastSignificantBit * '0';
+        uint64_t characters[2] = { Zeros, Zeros };
+        memcpy(characters, source, end - source);
+        decode(characters, end - source);
+    }
+    return errors ? InvalidEncoding : input.size() / 2;
+}
+
+/// \brief The count of characters of the base64 encoding of \c size bytes,
+/// with padding
+constexpr std::size_t base64EncodedSize(std::size_t size) noexcept {
+    return (size + 2) / 3 * 4;
+}
+
+/// \brief Writes the base64 encoding of \c input, with the standard
+/// alphabet and padding, to \c output, returns the count written
+/// \pre \c output has room for <tt>base64EncodedSize(input.size())</tt>
+inline std::size_t
+encodeBase64(ByteSpan input, MutableByteSpan output) noexcept {
+    constexpr auto BlockSize = sizeof(uint64_t), GroupSize = std::size_t(6);
+    auto source = input.data();
+    auto destination = output.data();
+    auto encode = [&](uint64_t bytes, std::size_t count) {
+        auto characters = impl::base64Characters(bytes);
+        memcpy(destination, &characters, count);
+        destination += count;
+    };
+    auto end = input.end();
+    // the loads of whole words read 2 bytes after the group
+    for(; BlockSize <= std::size_t(end - source); source += GroupSize) {
+        uint64_t bytes;
+        memcpy(&bytes, source, BlockSize);
+        encode(bytes, BlockSize);
+    }
+    std::size_t remaining = end - source;
+    if(remaining) {
+        uint64_t bytes = 0;
+        memcpy(&bytes, source, remaining);
+        if(GroupSize <= remaining) {
+            encode(bytes, BlockSize);
+            bytes >>= 8 * GroupSize;
+            remaining -= GroupSize;
+        }
+        if(remaining) {
+            // 4 characters for each 3 bytes, then the padding
+            encode(bytes, (4 * remaining + 2) / 3);
+            auto padding = (3 - remaining % 3) % 3;
+            memset(destination, '=', padding);
+        }
+    }
+    return base64EncodedSize(input.size());
+}
+
+/// \brief Writes the bytes of the base64 encoding \c input, with the
+/// standard alphabet and padding, to \c output, returns the count written,
+/// or \c InvalidEncoding if \c input is not valid
+///
+/// The bits of the last character beyond the last byte are ignored.
+/// \pre \c output has room for three quarters of the size of \c input
+/// \note For invalid inputs the contents of \c output are unspecified
+inline std::size_t
+decodeBase64(ByteSpan input, MutableByteSpan output) noexcept {
+    auto size = input.size();
+    if(size % 4) { return InvalidEncoding; }
+    auto source = input.data();
+    auto destination = output.data();
+    auto end = input.end();
+    for(auto padding = 0; padding < 2 && source != end; ++padding) {
+        if(std::byte{'='} != end[-1]) { break; }
+        --end;
+    }
+    constexpr auto BlockSize = sizeof(uint64_t), GroupSize = std::size_t(6);
+    uint64_t errors = 0;
+    auto decode = [&](uint64_t characters, std::size_t count) {
+        auto bytes = impl::base64Values(characters, errors);
+        memcpy(destination, &bytes, count);
+        destination += count;
+    };
+    for(; BlockSize <= std::size_t(end - source); source += BlockSize) {
+        uint64_t characters;
+        memcpy(&characters, source, BlockSize);
+        decode(characters, GroupSize);
+    }
+    if(source != end) {
+        // 2, 3, 4, 6 or 7 characters
+        uint64_t characters = ByteLanes::LeastSignificantBit * 'A';
+        memcpy(&characters, source, end - source);
+        decode(characters, (end - source) * GroupSize / BlockSize);
+    }
+    if(errors) { return InvalidEncoding; }
+    return destination - output.data();
+}
+
+}}
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef ZOO_SWAR_PERMUTATIONS_H
+#define ZOO_SWAR_PERMUTATIONS_H
+
+/// \file permutations.h Moves of whole lanes: permutations by compile time
+/// indices, broadcast of a lane, interleave and deinterleave of the lanes of
+/// two SWARs, and the transposes of 8x8 matrices of bytes and bits.
+
+#include "zoo/swar/associative_iteration.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace zoo { namespace swar {
+
+namespace impl {
+
+/// \brief The lanes of a permutation that move by the same count of lanes,
+/// positive to the more significant lanes
+template<typename T>
+struct LaneMove {
+    int distance;
+    T destinations;
+};
+
+/// The permutation as the fewest moves: one per distinct distance
+template<int NB, typename T, int... Indices>
+struct PermutationMoves {
+    constexpr static auto Lanes = int(sizeof...(Indices));
+
+    struct Moves {
+        std::array<LaneMove<T>, sizeof...(Indices)> moves;
+        int count;
+    };
+
+    constexpr static Moves make() {
+        constexpr int Sources[] = { Indices... };
+        Moves rv{};
+        for(auto lane = 0; lane < Lanes; ++lane) {
+            auto distance = lane - Sources[lane];
+            auto destination = T(SWAR<NB, T>::LeastSignificantLaneMask << (lane * NB));
+            auto move = 0;
+            while(move < rv.count && rv.moves[move].distance != distance) { ++move; }
+            if(move == rv.count) { rv.moves[rv.count++] = { distance, 0 }; }
+            rv.moves[move].destinations |= destination;
+        }
+        return rv;
+    }
+
+    constexpr static Moves Value = make();
+};
+
+template<typename Moves, std::size_t Move, int NB, typename T>
+constexpr SWAR<NB, T> moveLanes(SWAR<NB, T> input) {
+    constexpr auto M = Moves::Value.moves[Move];
+    using S = SWAR<NB, T>;
+    auto moved =
+        0 <= M.distance ?
+            input.shiftLanesLeft(M.distance) :
+            input.shiftLanesRight(-M.distance);
+    return moved & S{M.destinations};
+}
+
+template<typename Moves, int NB, typename T, std::size_t... MoveIndices>
+constexpr SWAR<NB, T>
+applyMoves(SWAR<NB, T> input, std::index_sequence<MoveIndices...>) {
+    return (SWAR<NB, T>{0} | ... | moveLanes<Moves, MoveIndices>(input));
+}
+
+}
+
+/// \brief Lane \c i of the result is the lane \c Indices[i] of the input
+///
+/// The lanes that move the same count of lanes are moved together, with a
+/// shift and a mask; a rotation costs two, a reversal of 8 lanes eight.
+/// Repeated indices are supported.
+template<int... Indices, int NB, typename T>
+constexpr SWAR<NB, T> permuteLanes(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    static_assert(sizeof...(Indices) == S::Lanes, "An index per lane");
+    static_assert(((0 <= Indices && Indices < int(S::Lanes)) && ...));
+    using Moves = impl::PermutationMoves<NB, T, Indices...>;
+    return impl::applyMoves<Moves>(
+        input, std::make_index_sequence<Moves::Value.count>{}
+    );
+}
+
+/// \brief All the lanes with the value of the lane \c index
+///
+/// A single multiplication copies the isolated lane to all the lanes.
+template<int NB, typename T>
+constexpr SWAR<NB, T> broadcastLane(SWAR<NB, T> input, int index) {
+    using S = SWAR<NB, T>;
+    auto lane = T(input.at(index));
+    return S{T(lane * S::LeastSignificantBit)};
+}
+
+/// \brief The lanes of two SWARs, interleaved
+template<int NB, typename T>
+struct ZippedLanes {
+    SWAR<NB, T> low, high;
+};
+
+namespace impl {
+
+/// \brief The lanes of the least significant half spread to the even lanes
+template<int BlockLanes, int NB, typename T>
+constexpr T spreadToEvenLanes(T v) {
+    if constexpr(0 == BlockLanes) {
+        return v;
+    } else {
+        constexpr auto BlockBits = BlockLanes * NB;
+        // blocks of lanes in place every other block
+        constexpr auto Mask =
+            meta::BitmaskMaker<T, T((T(1) << BlockBits) - 1), 2 * BlockBits>::value;
+        return spreadToEvenLanes<BlockLanes / 2, NB, T>(T((v | (v << BlockBits)) & Mask));
+    }
+}
+
+/// \brief The even lanes gathered in the least significant half
+/// \pre the odd lanes are 0
+template<int BlockLanes, int NB, typename T>
+constexpr T gatherEvenLanes(T v) {
+    constexpr auto Lanes = int(sizeof(T) * 8) / NB;
+    if constexpr(Lanes / 2 <= BlockLanes) {
+        return v;
+    } else {
+        constexpr auto BlockBits = BlockLanes * NB;
+        constexpr auto Mask =
+            meta::BitmaskMaker<T, T((T(1) << (2 * BlockBits)) - 1), 4 * BlockBits>::value;
+        return gatherEvenLanes<2 * BlockLanes, NB, T>(T((v | (v >> BlockBits)) & Mask));
+    }
+}
+
+template<int NB, typename T>
+constexpr void assertZippable() {
+    using S = SWAR<NB, T>;
+    static_assert(0 == S::PaddingBitsCount, "Padding not supported");
+    static_assert(
+        1 < S::Lanes && 0 == (S::Lanes & (S::Lanes - 1)),
+        "Only counts of lanes power of two are supported"
+    );
+}
+
+}
+
+/// \brief Interleaves the lanes of \c a, in the even lanes, and \c b, in the
+/// odd lanes: the lanes of the lesser halves in \c low, the rest in \c high
+///
+/// Each half is spread to the even lanes in a logarithmic count of steps of
+/// shifts and masks, see "Hacker's Delight", 7-2 "Shuffling Bits".
+template<int NB, typename T>
+constexpr ZippedLanes<NB, T> zipLanes(SWAR<NB, T> a, SWAR<NB, T> b) {
+    using S = SWAR<NB, T>;
+    impl::assertZippable<NB, T>();
+    constexpr auto HalfBits = int(sizeof(T) * 8) / 2;
+    constexpr auto FirstBlock = int(S::Lanes) / 4;
+    auto spread = [](T v) {
+        return impl::spreadToEvenLanes<FirstBlock, NB, T>(v);
+    };
+    constexpr auto LowHalf = T((T(1) << HalfBits) - 1);
+    auto zip = [&](T fromA, T fromB) {
+        return S{T(spread(fromA & LowHalf) | (spread(fromB & LowHalf) << NB))};
+    };
+    return {
+        zip(a.value(), b.value()),
+        zip(T(a.value() >> HalfBits), T(b.value() >> HalfBits))
+    };
+}
+
+/// \brief The inverse of \c zipLanes: the even lanes of \c low followed by
+/// the even lanes of \c high, and the same for the odd lanes
+template<int NB, typename T>
+constexpr SWAR_Pair<NB, T> unzipLanes(SWAR<NB, T> low, SWAR<NB, T> high) {
+    using S = SWAR<NB, T>;
+    impl::assertZippable<NB, T>();
+    constexpr auto HalfBits = int(sizeof(T) * 8) / 2;
+    constexpr auto EvenLanes = doublingMask<NB, T>().value();
+    auto gather = [](T v) {
+        return impl::gatherEvenLanes<1, NB, T>(T(v & EvenLanes));
+    };
+    auto unzip = [&](int shift) {
+        auto fromLow = T(low.value() >> shift), fromHigh = T(high.value() >> shift);
+        return S{T(gather(fromLow) | (gather(fromHigh) << HalfBits))};
+    };
+    return { unzip(0), unzip(NB) };
+}
+
+/// \brief Transpose of the matrix of 8x8 bytes of the rows in \c rows, the
+/// byte \c j of the row \c i is the element of the column \c j
+///
+/// Three steps of exchanges of blocks, 4x4, 2x2 and 1x1 bytes, between rows
+/// 4, 2 and 1 apart, with shifts and masks.
+constexpr std::array<uint64_t, 8>
+transposeBytes8x8(std::array<uint64_t, 8> rows) noexcept {
+    constexpr uint64_t Masks[] = {
+        0x0000'0000'FFFF'FFFF, 0x0000'FFFF'0000'FFFF, 0x00FF'00FF'00FF'00FF
+    };
+    auto step = 0;
+    for(auto distance = 4; distance; distance >>= 1, ++step) {
+        auto shift = distance * 8;
+        for(auto row = 0; row < 8; ++row) {
+            if(row & distance) { continue; }
+            auto &upper = rows[row], &lower = rows[row + distance];
+            auto exchanged = ((upper >> shift) ^ lower) & Masks[step];
+            lower ^= exchanged;
+            upper ^= exchanged << shift;
+        }
+    }
+    return rows;
+}
+
+/// \brief Transpose of the matrix of 8x8 bits of \c v: byte \c i is the
+/// row \c i, its bit \c j the column \c j
+///
+/// "Hacker's Delight", 7-3, "Transposing a Bit Matrix": three exchanges of
+/// blocks of 1x1, 2x2 and 4x4 bits
+constexpr uint64_t transposeBits8x8(uint64_t v) noexcept {
+    auto t = (v ^ (v >> 7)) & 0x00AA'00AA'00AA'00AA;
+    v = v ^ t ^ (t << 7);
+    t = (v ^ (v >> 14)) & 0x0000'CCCC'0000'CCCC;
+    v = v ^ t ^ (t << 14);
+    t = (v ^ (v >> 28)) & 0x0000'0000'F0F0'F0F0;
+    return v ^ t ^ (t << 28);
+}
+
+}}
+
+#endif
@@ -0,0 +1,280 @@
+#ifndef ZOO_SWAR_RANGES_H
+#define ZOO_SWAR_RANGES_H
+
+/*! \file ranges.h
+\brief Algorithms over arbitrary ranges of bytes, a block of 8 bytes at a time
+
+The algorithms that only read, such as \c findByte, process the aligned
+blocks that contain the range.  Unlike \c c_strLength, which does not know
+where the string ends, they do not read outside of the range: the bytes of
+the range in the first and last blocks are copied to a block of zeros, and
+the lanes outside of the range are masked off.
+
+The algorithms that write, such as \c replaceByte, must not write outside
+of the range, other threads might be writing there: the bytes before the
+first aligned block and after the last are copied to a block, processed and
+copied back.
+*/
+
+#include "zoo/swar/SWAR.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string.h>
+#include <type_traits>
+#include <utility>
+
+namespace zoo { namespace swar {
+
+/// \brief The minimal subset of \c std::span of bytes of C++ 20 used by the
+/// algorithms in this file
+/// \tparam Byte either <tt>const std::byte</tt> or \c std::byte
+template<typename Byte>
+struct BasicByteSpan {
+    constexpr BasicByteSpan() noexcept: data_{nullptr}, size_{0} {}
+
+    /// Any pointer to a type of a single byte, such as \c char
+    template<
+        typename T,
+        typename = std::enable_if_t<
+            1 == sizeof(T) && (std::is_const_v<Byte> || !std::is_const_v<T>)
+        >
+    >
+    BasicByteSpan(T *data, std::size_t size) noexcept:
+        data_{reinterpret_cast<Byte *>(data)}, size_{size}
+    {}
+
+    /// Contiguous containers, such as \c std::string or \c std::vector<char>
+    template<
+        typename Container,
+        typename = decltype(
+            BasicByteSpan(
+                std::declval<Container &>().data(),
+                std::declval<Container &>().size()
+            )
+        )
+    >
+    BasicByteSpan(Container &c) noexcept: BasicByteSpan(c.data(), c.size()) {}
+
+    /// Mutable to constant
+    template<
+        typename Other,
+        typename = std::enable_if_t<std::is_const_v<Byte> && !std::is_const_v<Other>>
+    >
+    constexpr BasicByteSpan(BasicByteSpan<Other> other) noexcept:
+        data_{other.data()}, size_{other.size()}
+    {}
+
+    constexpr Byte *data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return 0 == size_; }
+    constexpr Byte *begin() const noexcept { return data_; }
+    constexpr Byte *end() const noexcept { return data_ + size_; }
+
+private:
+    Byte *data_;
+    std::size_t size_;
+};
+
+using ByteSpan = BasicByteSpan<const std::byte>;
+using MutableByteSpan = BasicByteSpan<std::byte>;
+
+/// The blocks the algorithms process, with the interface of \c SWAR
+using ByteLanes = SWAR<8, uint64_t>;
+using ByteBooleans = BooleanSWAR<8, uint64_t>;
+
+namespace impl {
+
+/// \brief Calls <tt>consume(block, valid, base)</tt> with each aligned block
+/// that contains bytes of the range, in order, until it returns \c true
+///
+/// \c valid has the lanes with bytes of the range, \c base points to the
+/// first byte of the block, that may be before the beginning of the range;
+/// the lanes outside of the range are 0.  The blocks in between the first
+/// and last are loaded whole and processed in a loop without masks.
+template<typename Consumer>
+void forEachBlock(ByteSpan range, Consumer &&consume) {
+    if(range.empty()) { return; }
+    constexpr auto BlockSize = sizeof(uint64_t);
+    constexpr auto AllOn = ~uint64_t(0);
+    constexpr ByteBooleans AllValid{ByteLanes::MostSignificantBit};
+    auto begin = range.begin(), end = range.end();
+    auto misalignment = reinterpret_cast<std::uintptr_t>(begin) % BlockSize;
+    auto base = begin - misalignment;
+    // only the bytes in [from, to) of the block at base
+    auto partialLoad = [&base](const std::byte *from, const std::byte *to) {
+        ByteLanes block{0};
+        memcpy(
+            reinterpret_cast<std::byte *>(&block.m_v) + (from - base),
+            from, to - from
+        );
+        return block;
+    };
+    auto valid = AllValid & ByteBooleans{AllOn << (8 * misalignment)};
+    auto from = begin;
+    for(;;) {
+        auto next = base + BlockSize;
+        if(end <= next) {
+            // 1 <= end - base <= 8
+            auto bytesInRange = end - base;
+            valid = valid & ByteBooleans{AllOn >> (64 - 8 * bytesInRange)};
+            consume(partialLoad(from, end), valid, base);
+            return;
+        }
+        ByteLanes block;
+        if(from == base) {
+            memcpy(&block.m_v, base, BlockSize);
+        } else {
+            block = partialLoad(from, next);
+        }
+        if(consume(block, valid, base)) { return; }
+        base = from = next;
+        // Only the first block is misaligned
+        valid = AllValid;
+    }
+}
+
+/// \brief Replaces each block of the range with <tt>transform(block)</tt>
+///
+/// The bytes of the range before the first aligned block and after the last
+/// are processed together in the lowest lanes of a block, the other lanes of
+/// the block are 0; \c transform must treat the lanes independently.
+template<typename Transformation>
+void transformBlocks(MutableByteSpan range, Transformation &&transform) {
+    constexpr auto BlockSize = sizeof(uint64_t);
+    auto partial = [&transform](std::byte *where, std::size_t count) {
+        ByteLanes block{0};
+        memcpy(&block.m_v, where, count);
+        block = transform(block);
+        memcpy(where, &block.m_v, count);
+    };
+    auto current = range.begin(), end = range.end();
+    auto misalignment = reinterpret_cast<std::uintptr_t>(current) % BlockSize;
+    if(misalignment) {
+        std::size_t beforeAligned = BlockSize - misalignment;
+        auto count = beforeAligned < range.size() ? beforeAligned : range.size();
+        partial(current, count);
+        current += count;
+    }
+    for(; BlockSize <= std::size_t(end - current); current += BlockSize) {
+        ByteLanes block;
+        memcpy(&block.m_v, current, BlockSize);
+        block = transform(block);
+        memcpy(current, &block.m_v, BlockSize);
+    }
+    if(current != end) { partial(current, end - current); }
+}
+
+constexpr ByteLanes broadcastByte(std::byte b) noexcept {
+    return broadcast(ByteLanes{uint64_t(b)});
+}
+
+}
+
+/// \brief Index of the first byte equal to \c needle, the size if none
+inline std::size_t findByte(ByteSpan range, std::byte needle) noexcept {
+    auto pattern = impl::broadcastByte(needle);
+    auto rv = range.size();
+    impl::forEachBlock(
+        range,
+        [&](ByteLanes block, ByteBooleans valid, const std::byte *base) {
+            auto matches = equals(block, pattern) & valid;
+            if(matches) { rv = base + matches.lsbIndex() - range.data(); }
+            return bool(matches);
+        }
+    );
+    return rv;
+}
+
+/// \brief Count of the bytes equal to \c needle
+inline std::size_t countByte(ByteSpan range, std::byte needle) noexcept {
+    auto pattern = impl::broadcastByte(needle);
+    std::size_t rv = 0;
+    impl::forEachBlock(
+        range,
+        [&](ByteLanes block, ByteBooleans valid, const std::byte *) {
+            auto matches = equals(block, pattern) & valid;
+            rv += popcount<6>(matches.value());
+            return false;
+        }
+    );
+    return rv;
+}
+
+/// \brief Index of the first byte equal to any in \c set, the size if none
+/// \note each byte in the set costs an equality comparison per block
+inline std::size_t findFirstOf(ByteSpan range, ByteSpan set) noexcept {
+    auto rv = range.size();
+    impl::forEachBlock(
+        range,
+        [&](ByteLanes block, ByteBooleans valid, const std::byte *base) {
+            auto matches = ByteBooleans{0};
+            for(auto b: set) {
+                matches = matches | equals(block, impl::broadcastByte(b));
+            }
+            matches = matches & valid;
+            if(matches) { rv = base + matches.lsbIndex() - range.data(); }
+            return bool(matches);
+        }
+    );
+    return rv;
+}
+
+/// \brief Whether \c predicate is true for all the bytes
+/// \param predicate maps a block of \c ByteLanes to \c ByteBooleans
+template<typename Predicate>
+bool allOf(ByteSpan range, Predicate &&predicate) {
+    auto rv = true;
+    impl::forEachBlock(
+        range,
+        [&](ByteLanes block, ByteBooleans valid, const std::byte *) {
+            ByteBooleans satisfied = predicate(block);
+            // "operator not" of BooleanSWAR is lane-wise
+            rv = !bool(valid & ~satisfied);
+            return !rv;
+        }
+    );
+    return rv;
+}
+
+/// \brief Whether \c predicate is true for any byte
+/// \param predicate maps a block of \c ByteLanes to \c ByteBooleans
+template<typename Predicate>
+bool anyOf(ByteSpan range, Predicate &&predicate) {
+    auto rv = false;
+    impl::forEachBlock(
+        range,
+        [&](ByteLanes block, ByteBooleans valid, const std::byte *) {
+            ByteBooleans satisfied = predicate(block);
+            rv = bool(valid & satisfied);
+            return rv;
+        }
+    );
+    return rv;
+}
+
+/// \brief Replaces the bytes of the range with the result of \c transformation
+/// \param transformation maps a block of \c ByteLanes to another, each lane
+/// must depend only on the same lane of the argument
+template<typename Transformation>
+void transformLanes(MutableByteSpan range, Transformation &&transformation) {
+    impl::transformBlocks(range, transformation);
+}
+
+/// \brief Replaces the bytes equal to \c from with \c to
+inline void
+replaceByte(MutableByteSpan range, std::byte from, std::byte to) noexcept {
+    auto pattern = impl::broadcastByte(from);
+    auto difference = impl::broadcastByte(from ^ to);
+    impl::transformBlocks(
+        range,
+        [=](ByteLanes block) {
+            auto matches = equals(block, pattern).MSBtoLaneMask();
+            return block ^ (difference & matches);
+        }
+    );
+}
+
+}}
+
+#endif
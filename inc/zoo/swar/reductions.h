@@ -0,0 +1,121 @@
+#ifndef ZOO_SWAR_REDUCTIONS_H
+#define ZOO_SWAR_REDUCTIONS_H
+
+/// \file reductions.h Operations across the lanes: horizontal reductions and
+/// prefix sums.  Lane 0 is the least significant.
+
+#include "zoo/swar/arithmetic.h"
+
+namespace zoo { namespace swar {
+
+namespace impl {
+
+/// \tparam ValueBits how many of the least significant bits of each lane may
+/// be set
+template<int ValueBits, int NB, typename T>
+constexpr auto horizontalSum(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    using R = typename S::type;
+    constexpr auto SumBits = ValueBits + meta::logCeiling(S::Lanes);
+    if constexpr(1 == S::Lanes) {
+        return R(input.value());
+    } else if constexpr(SumBits <= NB) {
+        // None of the prefix sums overflow their lanes, the prefix sum at the
+        // most significant lane is the sum of all
+        auto prefixSums = R(input.value() * S::LeastSignificantBit);
+        return R(prefixSums >> (NB * (S::Lanes - 1)));
+    } else {
+        auto halves = doublePrecision(input);
+        return horizontalSum<ValueBits + 1>(halves.even + halves.odd);
+    }
+}
+
+}
+
+/// \brief Inclusive prefix sum of the lanes, modulo the lane width: lane
+/// \c i of the result is the sum of the lanes 0 to \c i
+///
+/// Takes the logarithm of the count of lanes steps, each adds the lanes
+/// moved up by a power of two.
+template<int NB, typename T>
+constexpr SWAR<NB, T> prefixSumLanes(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    auto rv = input;
+    for(auto distance = 1; distance < int(S::Lanes); distance <<= 1) {
+        rv = fullAddition(rv, rv.shiftLanesLeft(distance)).result;
+    }
+    return rv;
+}
+
+/// \brief \c prefixSumLanes in a single multiplication by the lane-wise ones
+/// \pre none of the prefix sums overflows its lane, or the carries corrupt
+/// the more significant lanes; a way to guarantee it is to double the
+/// precision of the lanes before, see \c doublePrecision
+template<int NB, typename T>
+constexpr SWAR<NB, T> prefixSumLanes_OverflowUnsafe(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    return S{T(input.value() * S::LeastSignificantBit)} & S{S::AllOnes};
+}
+
+/// \brief Exclusive prefix sum of the lanes, modulo the lane width: lane
+/// \c i is the sum of the lanes before \c i, the offset of the elements of
+/// lane \c i if the lanes were counts of elements to place one after another
+template<int NB, typename T>
+constexpr SWAR<NB, T> exclusivePrefixSumLanes(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    // shifting by all the bits is undefined
+    if constexpr(1 == S::Lanes) { return S{0}; }
+    else { return prefixSumLanes(input).shiftLanesLeft(1) & S{S::AllOnes}; }
+}
+
+/// \brief The exact sum of all the lanes, which may need more bits than a
+/// lane
+///
+/// The lanes are widened with \c doublePrecision only until their sum can
+/// not overflow a lane, then one multiplication by the lane-wise ones adds
+/// them.  For example, the sum of byte lanes needs 11 bits, thus it is
+/// performed in lanes of 16 bits.
+template<int NB, typename T>
+constexpr auto horizontalSum(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    using R = typename S::type;
+    if constexpr(0 == S::PaddingBitsCount && 0 == (S::Lanes & (S::Lanes - 1))) {
+        return impl::horizontalSum<NB>(input);
+    } else {
+        // the lane count can not be halved
+        R rv = 0;
+        for(auto lane = 0; lane < int(S::Lanes); ++lane) { rv += input.at(lane); }
+        return rv;
+    }
+}
+
+/// \brief Maximum of the lanes, interpreted as unsigned integers
+///
+/// Folds the most significant half of the lanes onto the other half with a
+/// lane-wise maximum, taking the logarithm of the count of lanes steps.
+template<int NB, typename T>
+constexpr auto horizontalMax(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    using R = typename S::type;
+    // the padding bits would be shifted into the lanes
+    auto rv = input & S{S::AllOnes};
+    for(auto lanes = int(S::Lanes); 1 < lanes; ) {
+        // the lanes beyond the count have values of the input or 0
+        auto half = (lanes + 1) / 2;
+        rv = maximum(rv, rv.shiftLanesRight(half));
+        lanes = half;
+    }
+    return R(rv.value() & S::LeastSignificantLaneMask);
+}
+
+/// \brief Minimum of the lanes, interpreted as unsigned integers
+template<int NB, typename T>
+constexpr auto horizontalMin(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    using R = typename S::type;
+    return R(S::LeastSignificantLaneMask & ~horizontalMax(~input));
+}
+
+}}
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef ZOO_SWAR_SORTING_H
+#define ZOO_SWAR_SORTING_H
+
+/// \file sorting.h Sorting networks that sort the lanes of a SWAR in
+/// registers, in ascending order of the unsigned interpretation; lane 0,
+/// the least significant, gets the minimum.
+///
+/// The comparators of a step of a network that compare lanes at the same
+/// distance are applied together: the lanes are compared with the lanes
+/// shifted by the distance, the lower lane of each pair keeps the minimum
+/// and the upper the maximum.
+
+#include "zoo/swar/bits.h"
+
+#include <array>
+#include <utility>
+
+namespace zoo { namespace swar {
+
+/// \brief The lane-wise minimums and maximums of two SWARs
+template<int NB, typename B>
+struct MinMax {
+    SWAR<NB, B> lesser, greater;
+};
+
+/// \brief Compare-exchange of the lanes of two SWARs
+template<int NB, typename B>
+constexpr MinMax<NB, B> minMax(SWAR<NB, B> a, SWAR<NB, B> b) {
+    auto aIsGreaterEqual = greaterEqual(a, b);
+    return { select(aIsGreaterEqual, b, a), select(aIsGreaterEqual, a, b) };
+}
+
+/// \brief The lanes in reverse order
+/// \pre the lanes fill the type, without padding bits, and their count is
+/// a power of two
+template<int NB, typename T>
+constexpr SWAR<NB, T> reverseLanes(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    static_assert(0 == S::PaddingBitsCount, "Padding not supported");
+    static_assert(
+        0 == (S::Lanes & (S::Lanes - 1)),
+        "Only counts of lanes power of two are supported"
+    );
+    constexpr auto Width = int(sizeof(T) * 8);
+    // the lanes are groups of bits of the whole
+    return S{impl::exchangeHalvesOfGroups<NB>(SWAR<Width, T>{input.value()}).value()};
+}
+
+namespace impl {
+
+/// \brief A step of a sorting network: compare-exchange of each lane in
+/// \c lowerLanes with the lane at \c distance lanes above
+template<typename T>
+struct ComparatorStep {
+    int distance;
+    T lowerLanes;
+};
+
+template<int NB, typename T>
+constexpr T laneMask(int lane) {
+    return T(SWAR<NB, T>::LeastSignificantLaneMask << (lane * NB));
+}
+
+template<int Lanes>
+constexpr auto StepCountOfMergeExchange =
+    meta::logCeiling(Lanes) * (meta::logCeiling(Lanes) + 1) / 2;
+
+/// \brief The steps of the merge exchange of Batcher, Knuth's Algorithm
+/// 5.2.2M, which sorts any count of elements, not only powers of two
+template<int NB, typename T>
+constexpr auto mergeExchangeNetwork() {
+    constexpr int Lanes = SWAR<NB, T>::Lanes;
+    constexpr auto Log = meta::logCeiling(Lanes);
+    std::array<ComparatorStep<T>, StepCountOfMergeExchange<Lanes>> rv{};
+    auto step = 0;
+    for(auto p = 1 << (Log - 1); 0 < p; p >>= 1) {
+        auto q = 1 << (Log - 1), r = 0, d = p;
+        for(;;) {
+            T lowerLanes = 0;
+            for(auto i = 0; i < Lanes - d; ++i) {
+                if(r == (i & p)) { lowerLanes |= laneMask<NB, T>(i); }
+            }
+            rv[step++] = { d, lowerLanes };
+            if(q == p) { break; }
+            d = q - p;
+            q >>= 1;
+            r = p;
+        }
+    }
+    return rv;
+}
+
+/// \brief The steps that sort a bitonic sequence of a count of lanes power
+/// of two: halving distances, the lower half of each group is the lower
+template<int NB, typename T>
+constexpr auto bitonicMergeNetwork() {
+    constexpr int Lanes = SWAR<NB, T>::Lanes;
+    std::array<ComparatorStep<T>, meta::logCeiling(Lanes)> rv{};
+    auto step = 0;
+    for(auto d = Lanes / 2; 0 < d; d >>= 1) {
+        T lowerLanes = 0;
+        for(auto i = 0; i < Lanes; ++i) {
+            if(0 == (i & d)) { lowerLanes |= laneMask<NB, T>(i); }
+        }
+        rv[step++] = { d, lowerLanes };
+    }
+    return rv;
+}
+
+template<int NB, typename T>
+struct SortingNetworks {
+    constexpr static auto MergeExchange = mergeExchangeNetwork<NB, T>();
+    constexpr static auto BitonicMerge = bitonicMergeNetwork<NB, T>();
+};
+
+/// \brief The lanes in \c LowerLanes get the minimum of themselves and the
+/// lane \c Distance above, that gets the maximum
+///
+/// Each lane is compared once with its partner: the lower lanes take the
+/// partner if it is lesser, the upper lanes if it is greater.
+template<int Distance, auto LowerLanes, int NB, typename T>
+constexpr SWAR<NB, T> compareExchangeLanes(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    using BS = BooleanSWAR<NB, T>;
+    constexpr auto
+        Lower = S{LowerLanes},
+        Upper = S{T(LowerLanes << (Distance * NB))},
+        Untouched = S{T(~(LowerLanes | Upper.value()))};
+    constexpr auto UpperBooleans = BS{T(Upper.value() & S::MostSignificantBit)};
+    auto partner =
+        (input.shiftLanesRight(Distance) & Lower) |
+        (input.shiftLanesLeft(Distance) & Upper) |
+        (input & Untouched);
+    // the untouched lanes are their own partners
+    auto takePartner = greaterEqual(input, partner) ^ UpperBooleans;
+    return select(takePartner, partner, input);
+}
+
+template<
+    const auto &Network, int NB, typename T, std::size_t... Steps
+>
+constexpr SWAR<NB, T>
+applyNetwork(SWAR<NB, T> input, std::index_sequence<Steps...>) {
+    (
+        (input = compareExchangeLanes<
+            Network[Steps].distance, Network[Steps].lowerLanes
+        >(input)),
+        ...
+    );
+    return input;
+}
+
+}
+
+/// \brief The lanes sorted in ascending order, with the merge exchange
+/// network of Batcher generated at compile time for the count of lanes
+///
+/// A network for \c L lanes has <tt>log(L) * (log(L) + 1) / 2</tt> steps,
+/// 6 for 8 lanes.  The padding bits are cleared.
+template<int NB, typename T>
+constexpr SWAR<NB, T> sortLanes(SWAR<NB, T> input) {
+    using S = SWAR<NB, T>;
+    input = input & S{S::AllOnes};
+    if constexpr(1 == S::Lanes) {
+        return input;
+    } else {
+        constexpr auto &Network = impl::SortingNetworks<NB, T>::MergeExchange;
+        return impl::applyNetwork<Network>(
+            input, std::make_index_sequence<Network.size()>{}
+        );
+    }
+}
+
+/// \brief Merge of two SWARs with their lanes sorted: \c lesser has the
+/// lesser half of all the lanes, \c greater the greater half, both sorted
+///
+/// The lanes of \c b reversed make with the lanes of \c a a bitonic
+/// sequence, a compare-exchange of the two SWARs splits it in two bitonic
+/// sequences of the lesser and greater halves, each sorted by the bitonic
+/// merge network.
+/// \pre the count of lanes is a power of two, without padding bits
+template<int NB, typename T>
+constexpr MinMax<NB, T> mergeSortedLanes(SWAR<NB, T> a, SWAR<NB, T> b) {
+    using S = SWAR<NB, T>;
+    auto halves = minMax(a, reverseLanes(b));
+    if constexpr(1 == S::Lanes) {
+        return halves;
+    } else {
+        constexpr auto &Network = impl::SortingNetworks<NB, T>::BitonicMerge;
+        constexpr auto Steps = std::make_index_sequence<Network.size()>{};
+        return {
+            impl::applyNetwork<Network>(halves.lesser, Steps),
+            impl::applyNetwork<Network>(halves.greater, Steps)
+        };
+    }
+}
+
+}}
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef ZOO_SWAR_UTF8_H
+#define ZOO_SWAR_UTF8_H
+
+/*! \file utf8.h
+\brief Validation of UTF-8 and count of code points, a block of 8 bytes at a
+time
+
+The bytes are classified by their count of leading ones: 0 for ASCII, 1 for
+continuation bytes, 2 to 4 for the first byte of a sequence of that length.
+A block is valid when its continuation bytes are exactly those required by
+the first bytes up to 3 positions before, which may be in the previous
+block, and the second bytes of the sequences of three and four bytes exclude
+the overlong encodings, the surrogates and the values beyond U+10FFFF.
+Blocks of ASCII that follow blocks of ASCII are skipped with a single test,
+those that follow other blocks only check the sequences that continue.
+*/
+
+#include "zoo/swar/ranges.h"
+
+namespace zoo { namespace swar {
+
+namespace impl {
+
+/// \brief The lanes whose byte starts with at least \c Count ones
+template<int Count>
+constexpr ByteBooleans leadingOnesAtLeast(ByteLanes bytes) noexcept {
+    auto v = bytes.value(), rv = v;
+    // the bit 7 of each lane gets the bit 7 - shift of the same lane
+    for(auto shift = 1; shift < Count; ++shift) { rv &= v << shift; }
+    return ByteBooleans{rv & ByteLanes::MostSignificantBit};
+}
+
+constexpr ByteBooleans continuationBytes(ByteLanes bytes) noexcept {
+    return leadingOnesAtLeast<1>(bytes) & ~leadingOnesAtLeast<2>(bytes);
+}
+
+/// \brief The lanes whose bits in \c Mask, as a number, are at least
+/// \c Minimum
+///
+/// The sum reaches the most significant bit of the lane, without carrying
+/// to the next, only if the field is at least \c Minimum.
+template<unsigned Mask, unsigned Minimum>
+constexpr ByteBooleans fieldAtLeast(ByteLanes bytes) noexcept {
+    static_assert(Mask < 0x80 && 0 < Minimum && Minimum <= Mask);
+    constexpr auto Ones = ByteLanes::LeastSignificantBit;
+    auto sum = (bytes.value() & (Ones * Mask)) + Ones * (0x80 - Minimum);
+    return ByteBooleans{sum & ByteLanes::MostSignificantBit};
+}
+
+/// \brief The lanes \c Distance positions before each of \c current, from
+/// \c previous for the first lanes
+template<int Distance, typename Lanes>
+constexpr Lanes preceding(Lanes current, Lanes previous) noexcept {
+    return Lanes{
+        (current.value() << (8 * Distance)) |
+        (previous.value() >> (64 - 8 * Distance))
+    };
+}
+
+/// \brief The lanes with a zero in the low nibble
+constexpr ByteBooleans lowNibbleIsZero(uint64_t bytes) noexcept {
+    return ~fieldAtLeast<0x0F, 1>(ByteLanes{bytes});
+}
+
+/// \brief The lanes of \c current that make the text invalid, \c previous
+/// is the block before
+///
+/// The classes of the bytes before are those of \c current and \c previous
+/// moved up; all the comparisons are of fields of the bytes with constants,
+/// with masks and additions.
+constexpr ByteBooleans
+utf8Errors(ByteLanes current, ByteLanes previous) noexcept {
+    auto
+        two = leadingOnesAtLeast<2>(current),
+        three = leadingOnesAtLeast<3>(current),
+        four = leadingOnesAtLeast<4>(current),
+        five = leadingOnesAtLeast<5>(current),
+        previousTwo = leadingOnesAtLeast<2>(previous),
+        previousThree = leadingOnesAtLeast<3>(previous),
+        previousFour = leadingOnesAtLeast<4>(previous),
+        previousFive = leadingOnesAtLeast<5>(previous);
+    auto required =
+        preceding<1>(two, previousTwo) | preceding<2>(three, previousThree) |
+        preceding<3>(four, previousFour);
+    auto misplaced = required ^ continuationBytes(current);
+    // 0xC0 and 0xC1 would be overlong encodings of ASCII, 0xF5 and above
+    // are beyond U+10FFFF
+    auto invalidBytes =
+        (two & ~three & ~fieldAtLeast<0x1E, 2>(current)) |
+        (four & ~five & fieldAtLeast<0x07, 5>(current)) |
+        five;
+    // The second byte after 0xE0 must be at least 0xA0, after 0xED below,
+    // after 0xF0 at least 0x90 and after 0xF4 below.  Of a continuation
+    // byte, "at least 0xA0" is its bit 5, "at least 0x90" its bits 5 or 4:
+    // the low nibble of the first byte, xor 0xD or 4 when those bits are
+    // set, is zero only for the errors
+    constexpr auto Ones = ByteLanes::LeastSignificantBit;
+    auto second = current.value();
+    auto threeChange = ((second >> 5) & Ones) * 0x0D,
+         fourChange = (((second & (Ones * 0x30)) + Ones * 0x30) >> 4) & (Ones * 4);
+    auto before1 = preceding<1>(current, previous).value();
+    auto
+        firstOfThree = preceding<1>(three & ~four, previousThree & ~previousFour),
+        firstOfFour = preceding<1>(four & ~five, previousFour & ~previousFive);
+    auto secondByteErrors =
+        (firstOfThree & lowNibbleIsZero(before1 ^ threeChange)) |
+        (firstOfFour & lowNibbleIsZero(before1 ^ fourChange));
+    return misplaced | invalidBytes | secondByteErrors;
+}
+
+}
+
+/// \brief Whether the range is valid UTF-8, RFC 3629
+inline bool validateUTF8(ByteSpan range) noexcept {
+    constexpr auto HighBits = ByteLanes::MostSignificantBit;
+    ByteLanes previous{0};
+    auto valid = true;
+    impl::forEachBlock(
+        range,
+        [&](ByteLanes block, ByteBooleans inRange, const std::byte *) {
+            // the bytes outside of the range are ASCII 0
+            block = block & inRange.MSBtoLaneMask();
+            if(block.value() & HighBits) {
+                valid = !bool(impl::utf8Errors(block, previous));
+            } else if(previous.value() & HighBits) {
+                // only the sequences of the previous block can be invalid
+                valid = !bool(impl::utf8Errors(ByteLanes{0}, previous));
+            }
+            previous = block;
+            return !valid;
+        }
+    );
+    // the sequences that continue past the end of the last block
+    return valid && !bool(impl::utf8Errors(ByteLanes{0}, previous));
+}
+
+/// \brief Count of the bytes that are not continuation bytes, the count of
+/// code points of valid UTF-8
+inline std::size_t countCodePoints(ByteSpan range) noexcept {
+    std::size_t rv = 0;
+    impl::forEachBlock(
+        range,
+        [&](ByteLanes block, ByteBooleans inRange, const std::byte *) {
+            auto starts = inRange & ~impl::continuationBytes(block);
+            rv += popcount<6>(starts.value());
+            return false;
+        }
+    );
+    return rv;
+}
+
+}}
+
+#endif
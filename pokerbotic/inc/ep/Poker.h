@@ -2,6 +2,8 @@
 
 #include "core/SWAR.h"
 
+#include "zoo/swar/associative_iteration.h"
+
 
 #include "ep/PokerTypes.h"
 
@@ -58,14 +60,16 @@ struct CardSet {
     constexpr RankCounts counts() { return RankCounts(m_ranks); }
 
     static unsigned ranks(uint64_t arg);/* {
+        using S = zoo::swar::SWAR<64, uint64_t>;
         constexpr auto selector = ep::core::makeBitmask<4>(uint64_t(1));
-        return __builtin_ia32_pext_di(arg, selector);
+        return compress(S{arg}, S{selector}).value();
     }*/
 
     static unsigned ranks(RankCounts rc);/* {
         constexpr auto selector = ep::core::makeBitmask<4>(uint64_t(8));
         auto present = rc.greaterEqual<1>();
-        return __builtin_ia32_pext_di(present.value(), selector);
+        using S = zoo::swar::SWAR<64, uint64_t>;
+        return compress(S{present.value()}, S{selector}).value();
     }*/
 
     constexpr uint64_t cards() { return m_ranks.value(); }
@@ -130,13 +134,15 @@ union HandRank {
 };
 
 inline unsigned toRanks(uint64_t ranks) {
+    using S = zoo::swar::SWAR<64, uint64_t>;
     constexpr auto selector = ep::core::makeBitmask<4>(uint64_t(1));
-    return __builtin_ia32_pext_di(ranks, selector);
+    return compress(S{ranks}, S{selector}).value();
 }
 
 inline unsigned toRanks(RanksPresent rp) {
+    using S = zoo::swar::SWAR<64, uint64_t>;
     constexpr auto selector = ep::core::makeBitmask<4>(uint64_t(8));
-    return __builtin_ia32_pext_di(rp.value(), selector);
+    return compress(S{rp.value()}, S{selector}).value();
 }
 
 inline uint64_t flush(void *, uint64_t cards) { return flush(cards); }
@@ -1,13 +1,16 @@
 #pragma once
 
+#include "zoo/swar/associative_iteration.h"
+
 #include <stdint.h>
 
 namespace ep { namespace core {
 
 inline uint64_t deposit(uint64_t preselected, uint64_t extra) {
+    using S = zoo::swar::SWAR<64, uint64_t>;
     auto depositSelector = ~preselected;
-    auto deposited = __builtin_ia32_pdep_di(extra, depositSelector);
-    return deposited;
+    auto deposited = expand(S{extra}, S{depositSelector});
+    return deposited.value();
 }
 
 }}
@@ -56,7 +56,8 @@ constexpr uint64_t royalFlush() {
 TEST_CASE("Bit operations", "[bit]") {
     auto sevenNibbles = ep::core::makeBitmask<4, uint64_t>(7);
     auto octals = 01234567ull;
-    auto deposited = __builtin_ia32_pdep_di(octals, sevenNibbles);
+    using S = zoo::swar::SWAR<64, uint64_t>;
+    auto deposited = expand(S{octals}, S{sevenNibbles}).value();
     REQUIRE(0x1234567 == deposited);
 
     auto alreadySet = 0xC63; // 1 1 0 0 .0 1 1 0 .0 0 1 1
@@ -0,0 +1,97 @@
+#include "zoo/swar/arithmetic.h"
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch2/catch.hpp"
+
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+
+/// \file constant_multiplication.cpp Multiplication by constant multipliers
+/// of the lanes over the matrix of cases.plx: 3 lanes of 8 bits, each with
+/// a multiplier from 1 to 15
+
+namespace {
+
+using S = zoo::swar::SWAR<8, uint32_t>;
+
+constexpr auto Top = 16, LaneCount = 3, Bottom = 1;
+constexpr auto Values = Top - Bottom;
+constexpr auto CaseCount = Values * Values * Values;
+
+/// The multipliers of the case, in the order of cases.plx
+constexpr uint32_t multipliers(int caseIndex) {
+    uint32_t rv = 0;
+    for(auto lane = LaneCount; lane--; ) {
+        rv = (rv << 8) | (Bottom + caseIndex % Values);
+        caseIndex /= Values;
+    }
+    // the last lane of cases.plx varies the fastest, as the least significant
+    return rv;
+}
+
+enum Implementation { CanonicalSignedDigits, AssociativeIteration, Scalar };
+
+template<Implementation I, uint32_t Multipliers>
+S multiply(S x) {
+    using namespace zoo::swar;
+    if constexpr(CanonicalSignedDigits == I) {
+        return constantMultiplication_OverflowUnsafe<Multipliers>(x);
+    } else if constexpr(AssociativeIteration == I) {
+        // the multipliers have 4 significant bits
+        return multiplication_OverflowUnsafe_SpecificBitCount<4>(x, S{Multipliers});
+    } else {
+        uint32_t rv = 0;
+        for(auto lane = 0; lane < LaneCount; ++lane) {
+            auto shift = lane * 8;
+            rv |= (((x.value() >> shift) & 0xFF) * ((Multipliers >> shift) & 0xFF)) << shift;
+        }
+        return S{rv};
+    }
+}
+
+template<Implementation I, int Case>
+uint32_t traverse(const std::vector<uint32_t> &corpus) {
+    S rv{0};
+    for(auto v: corpus) { rv = rv ^ multiply<I, multipliers(Case)>(S{v}); }
+    return rv.value();
+}
+
+using Traversal = uint32_t (*)(const std::vector<uint32_t> &);
+
+template<Implementation I, std::size_t... Cases>
+constexpr std::array<Traversal, CaseCount>
+makeTraversals(std::index_sequence<Cases...>) {
+    return {traverse<I, Cases>...};
+}
+
+template<Implementation I>
+constexpr auto Traversals =
+    makeTraversals<I>(std::make_index_sequence<CaseCount>{});
+
+template<Implementation I>
+uint32_t allCases(const std::vector<uint32_t> &corpus) {
+    uint32_t rv = 0;
+    for(auto traversal: Traversals<I>) { rv ^= traversal(corpus); }
+    return rv;
+}
+
+}
+
+TEST_CASE("Multiplication by constants", "[profile][swar][multiplication]") {
+    std::mt19937 g(43);
+    // the products of 4 bits by 4 bits fit in the lanes
+    std::vector<uint32_t> corpus(64);
+    for(auto &v: corpus) { v = g() & 0x0F'0F'0F; }
+    auto expected = allCases<Scalar>(corpus);
+    REQUIRE(expected == allCases<CanonicalSignedDigits>(corpus));
+    REQUIRE(expected == allCases<AssociativeIteration>(corpus));
+    BENCHMARK("canonical signed digits") {
+        return allCases<CanonicalSignedDigits>(corpus);
+    };
+    BENCHMARK("associative iteration") {
+        return allCases<AssociativeIteration>(corpus);
+    };
+    BENCHMARK("scalar") { return allCases<Scalar>(corpus); };
+}
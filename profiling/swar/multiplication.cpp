@@ -83,6 +83,27 @@ auto normal_multiplication(const std::vector<uint64_t> &v) {
         >(v);
 }
 
+template<int NB>
+zoo::swar::SWAR<NB>
+wideningCombined(zoo::swar::SWAR<NB> m1, zoo::swar::SWAR<NB> m2) {
+    // both halves of the products are used
+    auto products = zoo::swar::wideningMultiplication(m1, m2);
+    return zoo::swar::SWAR<NB>{products.even.value() ^ products.odd.value()};
+}
+
+template<int NB>
+auto widening_multiplication(const std::vector<uint64_t> &v) {
+    return multiplicationTraverse<NB, wideningCombined<NB>>(v);
+}
+
+template<int NB>
+auto high_multiplication(const std::vector<uint64_t> &v) {
+    return
+        multiplicationTraverse<
+            NB, zoo::swar::multiplicationHighHalf<NB, uint64_t>
+        >(v);
+}
+
 template<int NB>
 auto compare_mul(zoo::swar::SWAR<NB> m1, zoo::swar::SWAR<NB> m2) {
     using namespace zoo::swar;
@@ -111,6 +132,8 @@ auto compare_multiplications(const std::vector<uint64_t> &v) {
 SIZES_X_LIST(normal_multiplication)
 SIZES_X_LIST(SWAR_multiplication)
 SIZES_X_LIST(compare_multiplications)
+SIZES_X_LIST(widening_multiplication)
+SIZES_X_LIST(high_multiplication)
 #undef X
 
 TEST_CASE("Swar Multiplication", "[profile][swar][multiplication]") {
@@ -126,5 +149,7 @@ TEST_CASE("Swar Multiplication", "[profile][swar][multiplication]") {
     SIZES_X_LIST(compare_multiplications)
     SIZES_X_LIST(SWAR_multiplication)
     SIZES_X_LIST(normal_multiplication)
+    SIZES_X_LIST(widening_multiplication)
+    SIZES_X_LIST(high_multiplication)
     #undef X
 }
@@ -0,0 +1,24 @@
+#include "zoo/meta/relocatable.h"
+
+#include <string>
+
+namespace {
+
+using namespace zoo::meta;
+
+#define SA(...) static_assert(__VA_ARGS__);
+
+SA(is_trivially_relocatable_v<int>)
+SA(is_trivially_relocatable_v<std::pair<int, double *>>)
+SA(is_trivially_relocatable_v<std::unique_ptr<int>>)
+SA(is_trivially_relocatable_v<std::pair<std::unique_ptr<int>, long>>)
+
+struct SelfReferent {
+    SelfReferent *self_ = this;
+    SelfReferent() = default;
+    SelfReferent(const SelfReferent &) {}
+};
+SA(!is_trivially_relocatable_v<SelfReferent>)
+SA(!is_trivially_relocatable_v<std::pair<int, SelfReferent>>)
+
+}
@@ -25,10 +25,15 @@ auto display(
     const auto hexPerSlot = static_cast<int>(HexPerSlot);
     snprintf(format, 59, "%%0%dllx %%0%dllx %%0%dllx", hexPerSlot, hexPerSlot, HexPerPSL);
 
+    // the slots around an index may be requested past the ends of the table,
+    // below 0 the subtractions wrap around
+    constexpr std::size_t SlotCount = Table::SWARCount * MD::NSlots;
+    if(SlotCount < end) { end = SlotCount; }
+    if(end < begin) { begin = 0; }
     auto swarNdx = begin / MD::NSlots;
-    auto swarEnd = end/MD::NSlots;
+    auto swarEnd = (end + MD::NSlots - 1) / MD::NSlots;
 
-    auto initial = t.md_[swarNdx];
+    MD initial;
     auto intra = 0;
     auto printLine =
         [&]() {
@@ -41,7 +46,7 @@ auto display(
             );
             out << buffer;
             if(initial.PSLs().at(0)) {
-                auto &v = t.values_[swarNdx * MD::NSlots + intra].value();
+                auto &v = t.slot(swarNdx * MD::NSlots + intra).value();
                 out << ' ' << v.first << ':' << v.second;
                 c(out, v.first, v.second);
             }
@@ -49,14 +54,15 @@ auto display(
             initial = initial.shiftLanesRight(1);
             ++intra;
         };
-    do {
+    while(swarNdx < swarEnd) {
+        initial = t.metadata(swarNdx);
         intra = 0;
         for(auto n = MD::NSlots; n--; ) {
             printLine();
         }
-        initial = t.md_[++swarNdx];
+        ++swarNdx;
         out << "- " << (swarNdx * MD::NSlots) << '\n';
-    } while(swarNdx < swarEnd);
+    }
     return out.str();
 }
 
@@ -67,22 +73,22 @@ auto display(const Table &t, std::size_t begin, std::size_t end) {
 
 template<typename Table>
 auto satisfiesInvariant(const Table &map, std::size_t begin = 0, std::size_t end = 0) {
-    auto size = map.md_.size();
+    auto size = Table::SWARCount;
     auto swarIndexBegin =
         (size <= begin) ?
             0 :
             begin / Table::MD::NSlots;
     auto swarIndexEnd =
         (begin == end) ?
-            map.md_.size() :
+            Table::SWARCount :
             (end + Table::MD::NSlots - 1)/Table::MD::NSlots; // ceiling
-    auto prior = map.md_[swarIndexBegin].PSLs().at(0);
+    auto prior = map.metadata(swarIndexBegin).PSLs().at(0);
     for(
         ;
         swarIndexBegin != swarIndexEnd;
         ++swarIndexBegin
     ) {
-        auto md = map.md_[swarIndexBegin];
+        auto md = map.metadata(swarIndexBegin);
         auto v = md.PSLs();
         for(auto n = Table::MD::NSlots; n--; ) {
             auto current = v.at(0);
@@ -1,5 +1,6 @@
 #include "zoo/map/RobinHood.h"
 #include "zoo/map/RobinHoodAlt.h"
+#include "zoo/map/RobinHoodCopyOnWrite.h"
 #include "zoo/map/RobinHoodUtil.h"
 
 #include "zoo/debug/rh/RobinHood.debug.h"
@@ -682,3 +683,337 @@ TEST_CASE("Robin Hood - Random", "[robin-hood]") {
     chain << "Seed " << seed << '\n';
     chain << zoo::debug::rh::display(rh, 0, RH::SlotCount);*/
 }
+
+TEST_CASE("Robin Hood - merge", "[robin-hood]") {
+    using RH = zoo::rh::RH_Frontend_WithSkarupkeTail<int, int, 5000, 7, 9>;
+    std::mt19937 g(1234);
+    std::uniform_int_distribution<int> keys(0, 6000);
+    RH mine, theirs;
+    std::map<int, int> expected;
+    for(auto count = 1500; count--; ) {
+        RH::value_type v{keys(g), 1};
+        mine.insert(v);
+        expected.insert(v);
+    }
+    std::map<int, int> other;
+    for(auto count = 1500; count--; ) {
+        RH::value_type v{keys(g), 10};
+        theirs.insert(v);
+        other.insert(v);
+    }
+    SECTION("merge keeps the mapped values already present") {
+        mine.merge(theirs);
+        for(auto &[k, v]: other) { expected.insert({k, v}); }
+    }
+    SECTION("merge_with combines the mapped values") {
+        mine.merge_with(theirs, [](int &m, int t) { m += t; });
+        for(auto &[k, v]: other) { expected[k] += v; }
+    }
+    SECTION("merging with itself") {
+        mine.merge(mine);
+        mine.merge_with(mine, [](int &m, int t) { m += t; });
+        for(auto &[k, v]: expected) { v += v; }
+    }
+    auto [valid, problem] = zoo::debug::rh::satisfiesInvariant(mine);
+    REQUIRE(valid);
+    REQUIRE(expected.size() == mine.elementCount_);
+    for(auto &[k, v]: expected) {
+        auto found = mine.find(k);
+        REQUIRE(mine.end() != found);
+        CHECK(v == found->second);
+    }
+}
+
+TEST_CASE("Robin Hood - hashed keys", "[robin-hood]") {
+    using Small = zoo::rh::RH_Frontend_WithSkarupkeTail<int, int, 1000, 6, 2>;
+    using Big = zoo::rh::RH_Frontend_WithSkarupkeTail<int, int, 3000, 6, 2>;
+    static_assert(std::is_same_v<Small::HashedKey, Big::HashedKey>);
+    Small small;
+    Big big;
+    for(auto k = 0; k < 600; ++k) {
+        auto hk = Small::hashed(k);
+        REQUIRE(small.insert(hk, Small::value_type{k, k}).second);
+        REQUIRE(big.insert(hk, Big::value_type{k, -k}).second);
+        REQUIRE(!big.insert(hk, Big::value_type{k, 0}).second);
+    }
+    CHECK(std::get<0>(zoo::debug::rh::satisfiesInvariant(small)));
+    CHECK(std::get<0>(zoo::debug::rh::satisfiesInvariant(big)));
+    for(auto k = 0; k < 1200; ++k) {
+        auto hk = Big::hashed(k);
+        auto inSmall = small.find(hk);
+        auto inBig = big.find(hk);
+        CHECK(inSmall == small.find(k));
+        CHECK(inBig == big.find(k));
+        if(k < 600) {
+            REQUIRE(small.end() != inSmall);
+            REQUIRE(big.end() != inBig);
+            CHECK(k == inSmall->second);
+            CHECK(-k == inBig->second);
+        } else {
+            CHECK(small.end() == inSmall);
+            CHECK(big.end() == inBig);
+        }
+    }
+}
+
+static_assert(5 == AutoTunedConfiguration<2048, 50>::PSL_Bits);
+static_assert(8 == AutoTunedConfiguration<2048, 50>::LaneBits);
+static_assert(16 == AutoTunedConfiguration<2048, 50, std::string>::LaneBits);
+static_assert(16 == AutoTunedConfiguration<(1 << 24), 90>::LaneBits);
+static_assert(
+    AutoTunedConfiguration<(1 << 24), 95>::ExpectedMaximumPSL <=
+    RH_Frontend_AutoTuned<int, int, (1 << 24), 95>::HighestSafePSL
+);
+
+TEST_CASE("Robin Hood - auto tuned configuration", "[robin-hood]") {
+    constexpr std::size_t Size = 20000;
+    auto load = GENERATE(50, 75, 90, 95);
+    std::mt19937 g(load);
+    auto fill = [&](auto &table) {
+        std::unordered_map<int, int> expected;
+        while(expected.size() < Size * std::size_t(load) / 100) {
+            auto k = int(g());
+            expected.insert({k, k});
+            table.insert(std::pair{k, k});
+        }
+        CHECK(std::get<0>(zoo::debug::rh::satisfiesInvariant(table)));
+        for(auto [k, v]: expected) {
+            auto found = table.find(k);
+            REQUIRE(table.end() != found);
+            CHECK(v == found->second);
+        }
+    };
+    switch(load) {
+        #define X(L) \
+            case L: { \
+                auto table = std::make_unique<RH_Frontend_AutoTuned<int, int, Size, L>>(); \
+                fill(*table); \
+                break; \
+            }
+        X(50) X(75) X(90) X(95)
+        #undef X
+    }
+}
+
+TEST_CASE("Robin Hood - erase_if", "[robin-hood]") {
+    using RH = zoo::rh::RH_Frontend_WithSkarupkeTail<int, int, 5000, 7, 9>;
+    auto table = std::make_unique<RH>();
+    std::mt19937 g(4321);
+    std::map<int, int> expected;
+    while(expected.size() < 4500) {
+        auto k = int(g() % 1000000);
+        expected.insert({k, k});
+        table->insert(std::pair{k, k});
+    }
+    auto modulo = GENERATE(2, 3, 5, 10);
+    auto victim = [modulo](const std::pair<const int, int> &p) {
+        return 0 == p.second % modulo;
+    };
+    std::size_t erasedExpected = 0;
+    for(auto it = expected.begin(); it != expected.end(); ) {
+        if(victim(*it)) { it = expected.erase(it); ++erasedExpected; }
+        else { ++it; }
+    }
+    auto erased =
+        table->erase_if([&](const std::pair<int, int> &p) { return victim(p); });
+    CHECK(erasedExpected == erased);
+    CHECK(expected.size() == table->elementCount_);
+    auto [valid, problem] = zoo::debug::rh::satisfiesInvariant(*table);
+    REQUIRE(valid);
+    std::size_t count = 0;
+    table->traverse([&](std::size_t, std::size_t) { ++count; });
+    CHECK(expected.size() == count);
+    for(auto [k, v]: expected) {
+        auto found = table->find(k);
+        REQUIRE(table->end() != found);
+        CHECK(v == found->second);
+    }
+    for(auto k = 0; k < 1000000; k += modulo * 97) {
+        CHECK(table->end() == table->find(k));
+    }
+    // the table remains usable for insertion
+    for(auto k = 0; k < 300; ++k) {
+        table->insert(std::pair{-k - 1, k});
+    }
+    CHECK(std::get<0>(zoo::debug::rh::satisfiesInvariant(*table)));
+}
+
+TEST_CASE("Robin Hood - copy-on-write snapshots", "[robin-hood]") {
+    using RH = RH_Frontend_CopyOnWrite<int, std::string, 5000, 7, 9, 256>;
+    RH table;
+    std::mt19937 g(1234);
+    std::map<int, std::string> before;
+    while(before.size() < 4000) {
+        auto k = int(g() % 1000000);
+        before.insert({k, std::to_string(k)});
+        table.insert(std::pair{k, std::to_string(k)});
+    }
+    auto stillEmpty = table.sharedPageCount();
+    auto view = snapshot(table);
+    CHECK(RH::PageCount == table.sharedPageCount());
+    // a search does not copy the page, only the writes through the iterator
+    auto firstKey = before.begin()->first;
+    RH::const_iterator firstFound = table.find(firstKey);
+    REQUIRE(table.end() != firstFound);
+    CHECK(before.begin()->second == firstFound->second);
+    CHECK(RH::PageCount == table.sharedPageCount());
+    // nor do the insertions and merges of keys already present
+    RH sameKeys;
+    for(auto it = before.begin(); it != before.end(); std::advance(it, 400)) {
+        CHECK(!table.insert(std::pair{it->first, std::string("other")}).second);
+        sameKeys.insert(std::pair{it->first, std::string("other")});
+    }
+    table.merge(sameKeys);
+    CHECK(RH::PageCount == table.sharedPageCount());
+    auto after = before;
+    // a few writes only copy the pages they touch
+    for(auto k = 0; k < 4; ++k) {
+        auto key = -k - 1;
+        after.insert({key, "new"});
+        table.insert(std::pair{key, std::string("new")});
+    }
+    after[firstKey] = "changed";
+    table.find(firstKey)->second = "changed";
+    CHECK(RH::PageCount - 12 < table.sharedPageCount());
+    CHECK(table.sharedPageCount() < RH::PageCount);
+    table.erase_if([](auto &p) { return 0 == p.first % 3; });
+    for(auto it = after.begin(); it != after.end(); ) {
+        if(0 == it->first % 3) { it = after.erase(it); }
+        else { ++it; }
+    }
+    CHECK(after.size() == table.elementCount_);
+    CHECK(before.size() == view->elementCount_);
+    CHECK(std::get<0>(zoo::debug::rh::satisfiesInvariant(table)));
+    CHECK(std::get<0>(zoo::debug::rh::satisfiesInvariant(*view)));
+    for(auto &[k, v]: before) {
+        auto found = view->find(k);
+        REQUIRE(view->end() != found);
+        CHECK(v == found->second);
+    }
+    CHECK(view->end() == view->find(-1));
+    for(auto &[k, v]: after) {
+        auto found = std::as_const(table).find(k);
+        REQUIRE(table.end() != found);
+        CHECK(v == found->second);
+    }
+    CHECK(table.end() == table.find(3));
+    view.reset();
+    CHECK(table.sharedPageCount() <= stillEmpty);
+}
+
+TEST_CASE("Robin Hood - relocation", "[robin-hood]") {
+    using Owning =
+        RH_Frontend_WithSkarupkeTail<int, std::unique_ptr<int>, 1000, 6, 10>;
+    using Strings = RH_Frontend_WithSkarupkeTail<int, std::string, 1000, 6, 10>;
+    static_assert(Owning::BitwiseRelocation && !Owning::BitwiseCopy);
+    static_assert(!Strings::BitwiseRelocation);
+    static_assert(FrontendExample::BitwiseCopy);
+    std::size_t keys = GENERATE(0, 1, 500, 900);
+    auto owning = std::make_unique<Owning>();
+    auto strings = std::make_unique<Strings>();
+    for(auto k = 0; k < int(keys); ++k) {
+        owning->insert(std::pair{k * 7, std::make_unique<int>(k)});
+        strings->insert(std::pair{k * 7, std::to_string(k)});
+    }
+    auto owningMoved = std::make_unique<Owning>(std::move(*owning));
+    auto stringsMoved = std::make_unique<Strings>(std::move(*strings));
+    CHECK(0 == owning->elementCount_);
+    CHECK(0 == strings->elementCount_);
+    CHECK(keys == owningMoved->elementCount_);
+    for(auto k = 0; k < int(keys); ++k) {
+        CHECK(owning->end() == owning->find(k * 7));
+        auto found = owningMoved->find(k * 7);
+        REQUIRE(owningMoved->end() != found);
+        CHECK(k == *found->second);
+        CHECK(std::to_string(k) == stringsMoved->find(k * 7)->second);
+    }
+    // the donors remain usable
+    owning->insert(std::pair{1, std::make_unique<int>(1)});
+    CHECK(1 == *owning->find(1)->second);
+    using Integers = RH_Frontend_WithSkarupkeTail<int, int, 1000, 6, 10>;
+    auto integers = std::make_unique<Integers>();
+    for(auto k = 0; k < int(keys); ++k) { integers->insert(std::pair{k, -k}); }
+    auto copy = std::make_unique<Integers>(*integers);
+    CHECK(keys == copy->elementCount_);
+    for(auto k = 0; k < int(keys); ++k) { CHECK(-k == copy->find(k)->second); }
+}
+
+static_assert(
+    0x8080 ==
+    zoo::rh::impl::Metadata<3, 5, u16>{0x0302}.sameHomeAsPrevious(1).value()
+);
+static_assert( // lane 0 after an empty slot, lane 1 after a poorer element
+    0 == zoo::rh::impl::Metadata<3, 5, u16>{0x0102}.sameHomeAsPrevious(0).value()
+);
+
+namespace {
+
+/// Makes runs of ClusterSize consecutive keys of the same home
+template<int ClusterSize>
+struct ClusteringHash {
+    std::size_t operator()(int k) const noexcept { return std::hash<int>{}(k / ClusterSize); }
+};
+
+}
+
+/// \c MV of the key \c k, strings are not relocated bitwise
+template<typename MV>
+MV erasureValue(int k) {
+    if constexpr(std::is_same_v<MV, std::string>) { return std::to_string(k); }
+    else { return MV(k); }
+}
+
+template<typename RH>
+void erasureCore() {
+    using MV = typename RH::value_type::second_type;
+    auto table = std::make_unique<RH>();
+    std::mt19937 g(9876);
+    std::map<int, MV> expected;
+    while(expected.size() < 4000) {
+        auto k = int(g() % 6000); // most clusters have several keys
+        expected.insert({k, erasureValue<MV>(k)});
+        table->insert(std::pair{k, erasureValue<MV>(k)});
+    }
+    std::vector<int> keys;
+    for(auto &kv: expected) { keys.push_back(kv.first); }
+    std::shuffle(keys.begin(), keys.end(), g);
+    for(std::size_t ndx = 0; ndx < keys.size(); ndx += 2) {
+        CHECK(1 == table->erase(keys[ndx]));
+        expected.erase(keys[ndx]);
+        CHECK(0 == table->erase(keys[ndx]));
+        if(0 == ndx % 256) {
+            REQUIRE(std::get<0>(zoo::debug::rh::satisfiesInvariant(*table)));
+        }
+    }
+    CHECK(std::get<0>(zoo::debug::rh::satisfiesInvariant(*table)));
+    CHECK(expected.size() == table->elementCount_);
+    std::size_t count = 0;
+    table->traverse([&](std::size_t, std::size_t) { ++count; });
+    CHECK(expected.size() == count);
+    for(auto &[k, v]: expected) {
+        auto found = table->find(k);
+        REQUIRE(table->end() != found);
+        CHECK(v == found->second);
+    }
+    for(std::size_t ndx = 0; ndx < keys.size(); ndx += 2) {
+        CHECK(table->end() == table->find(keys[ndx]));
+    }
+}
+
+TEST_CASE("Robin Hood - erase", "[robin-hood]") {
+    SECTION("rotation of the runs") {
+        erasureCore<
+            RH_Frontend_WithSkarupkeTail<int, std::string, 5000, 7, 9, ClusteringHash<5>>
+        >();
+    }
+    SECTION("backward shift of trivially relocatable elements") {
+        erasureCore<
+            RH_Frontend_WithSkarupkeTail<int, int, 5000, 7, 9, ClusteringHash<5>>
+        >();
+    }
+    SECTION("backward shift across pages") {
+        erasureCore<
+            RH_Frontend_CopyOnWrite<int, int, 5000, 7, 9, 256, ClusteringHash<5>>
+        >();
+    }
+}
@@ -0,0 +1,59 @@
+#include "zoo/map/StringInterner.h"
+
+#include <catch2/catch.hpp>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using Interner = zoo::rh::StringInterner<10000>;
+
+TEST_CASE("String interning - SWAR byte comparison", "[robin-hood][interner]") {
+    using zoo::rh::impl::firstDifferentByte;
+    char a[] = "The quick brown fox jumps over the lazy dog";
+    char b[] = "The quick brown fox jumps over the lazy dog";
+    constexpr auto Size = sizeof(a) - 1;
+    for(std::size_t count = 0; count <= Size; ++count) {
+        CHECK(count == firstDifferentByte(a, b, count));
+    }
+    for(std::size_t difference = 0; difference < Size; ++difference) {
+        b[difference] ^= 0x20;
+        CHECK(difference == firstDifferentByte(a, b, Size));
+        CHECK(difference == firstDifferentByte(a, b, difference + 1));
+        CHECK(difference == firstDifferentByte(a, b, difference));
+        b[difference] ^= 0x20;
+    }
+}
+
+TEST_CASE("String interning", "[robin-hood][interner]") {
+    Interner interner;
+    std::unordered_map<std::string, Interner::ID> expected;
+    std::mt19937 g(1234);
+    std::uniform_int_distribution<int> lengths(0, 40), characters('a', 'd');
+    for(auto count = 6000; count--; ) {
+        std::string s(lengths(g), ' ');
+        for(auto &c: s) { c = characters(g); }
+        auto id = interner.intern(s);
+        auto [where, inserted] = expected.insert({s, id});
+        CHECK(where->second == id);
+        if(inserted) { CHECK(expected.size() - 1 == id); }
+    }
+    REQUIRE(expected.size() == interner.size());
+    for(auto &[s, id]: expected) {
+        CHECK(s == interner.view(id));
+        CHECK(id == interner.find(s));
+    }
+    CHECK(interner.size() == interner.find("not present"));
+    SECTION("Interning a view into the arena") {
+        auto view = interner.view(0);
+        auto prefix = view.substr(0, view.size() / 2);
+        auto expectedID = interner.find(prefix);
+        auto id = interner.intern(prefix);
+        if(interner.size() - 1 == id) {
+            CHECK(interner.size() - 1 == expectedID);
+        } else {
+            CHECK(expectedID == id);
+        }
+        CHECK(interner.view(0).substr(0, prefix.size()) == interner.view(id));
+    }
+}
@@ -2,6 +2,7 @@
 
 #include "catch2/catch.hpp"
 
+#include <random>
 #include <string.h>
 #include <type_traits>
 
@@ -239,6 +240,54 @@ static_assert(
     multiplication_OverflowUnsafe_SpecificBitCount<3>(Micand, Mplier).value()
 );
 
+// 0xFF * 0xFF = 0xFE01, 0x10 * 0x20 = 0x200, 0x80 * 0x02 = 0x100, 3 * 7 = 0x15
+constexpr auto Widened =
+    wideningMultiplication(SWAR<8, u32>{0xFF'10'80'03}, SWAR<8, u32>{0xFF'20'02'07});
+static_assert(0x0200'0015 == Widened.even.value());
+static_assert(0xFE01'0100 == Widened.odd.value());
+static_assert(
+    0xFE'02'01'00 ==
+    multiplicationHighHalf(SWAR<8, u32>{0xFF'10'80'03}, SWAR<8, u32>{0xFF'20'02'07}).value()
+);
+static_assert(
+    0xFFFF'FFFE'0000'0001 ==
+    wideningMultiplication(SWAR<32, u64>{0xFFFF'FFFF}, SWAR<32, u64>{0xFFFF'FFFF}).even.value()
+);
+
+}
+
+namespace {
+
+template<int NB, typename T>
+void checkWideningMultiplication(std::mt19937_64 &g) {
+    using S = SWAR<NB, T>;
+    constexpr auto LaneMask = S::LeastSignificantLaneMask;
+    for(auto count = 1000; count--; ) {
+        S a{T(g())}, b{T(g())};
+        auto products = wideningMultiplication(a, b);
+        auto high = multiplicationHighHalf(a, b);
+        auto low = halvePrecision(products.even, products.odd);
+        for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+            auto product = uint64_t(a.at(lane)) * b.at(lane);
+            auto wide = lane & 1 ? products.odd : products.even;
+            CHECK(product == wide.at(lane / 2));
+            CHECK((product >> NB) == high.at(lane));
+            CHECK((product & LaneMask) == low.at(lane));
+        }
+    }
+}
+
+}
+
+TEST_CASE("Widening multiplication", "[swar]") {
+    std::mt19937_64 g(41);
+    checkWideningMultiplication<4, u64>(g);
+    checkWideningMultiplication<8, u64>(g);
+    checkWideningMultiplication<16, u64>(g);
+    checkWideningMultiplication<32, u64>(g);
+    checkWideningMultiplication<8, u32>(g);
+    checkWideningMultiplication<4, u16>(g);
+    checkWideningMultiplication<2, u8>(g);
 }
 
 #define HE(nbits, t, v0, v1) \
@@ -346,8 +395,37 @@ TEST_CASE("Compress/Expand", "[swar]") {
         auto v = compress(S{input}, S{mask});
         CHECK(expected == v.value());
     }
+    SECTION("Expand") {
+        auto e = expand(q, S32_32{Mask});
+        CHECK((ToMove & Mask) == e.value());
+    }
+    SECTION("Round trips, all lane widths") {
+        std::mt19937_64 g(37);
+        auto roundTrips = [&](auto s) {
+            using S = decltype(s);
+            for(auto count = 1000; count--; ) {
+                using T = typename S::type;
+                S input{T(g())}, mask{T(g())};
+                auto compressed = compress(input, mask);
+                CHECK((input & mask).value() == expand(compressed, mask).value());
+                CHECK(compressed.value() == compress(expand(compressed, mask), mask).value());
+            }
+        };
+        roundTrips(S4_64{});
+        roundTrips(S8_64{});
+        roundTrips(S16_64{});
+        roundTrips(SWAR<32, u64>{});
+        roundTrips(SWAR<64, u64>{});
+        roundTrips(S8_32{});
+    }
 }
 
+// the least significant bits of each lane go to the positions of the mask
+static_assert(
+    0x08'00'0C'03 ==
+    expand(S8_32{0x02'00'03'03}, S8_32{0x0A'F0'0C'03}).value()
+);
+
 static_assert(1 == popcount<5>(0x100ull));
 static_assert(1 == popcount<5>(0x010ull));
 static_assert(1 == popcount<5>(0x001ull));
@@ -611,20 +689,15 @@ TEST_CASE(
             CHECK(test.value() == greaterEqual<4, u32>(large, small).value());
         }
     }
-    // This uncovered an extension required for non-power of two lane sizes for
-    // equals/greaterEqual/etc related to the broadword nullcheck technique
-    // from taocp pg 152
-    // TODO(sbruce) figure out a performant fix.
-/*
     SECTION("single 3_16") {
-        for (uint32_t i = 1; i < 3; i++) {
+        for (uint32_t i = 1; i < 8; i++) {
             const auto left = S3_16{0}.blitElement(1,  i);
             const auto right = S3_16{S3_16::AllOnes}.blitElement(1, i-1);
-            const auto test = S3_16{0}.blitElement(1, 2);
+            // the most significant bit of the lane 1
+            const auto test = S3_16{0}.blitElement(1, 4);
             CHECK(test.value() == greaterEqual<3, u16>(left, right).value());
         }
     }
-*/
 }
 
 static_assert(0x123 == SWAR<4, uint32_t>(0x173).blitElement(1, 2).value());
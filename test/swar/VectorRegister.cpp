@@ -0,0 +1,118 @@
+#include "zoo/swar/VectorRegister.h"
+#include "zoo/swar/SWARWithSubLanes.h"
+
+#include "catch2/catch.hpp"
+
+#include <cstring>
+#include <random>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+using V128 = VectorRegister<128>;
+using V256 = VectorRegister<256>;
+using V512 = VectorRegister<512>;
+
+static_assert(32 == sizeof(V256) && 32 == alignof(V256));
+
+// carries and borrows across limbs
+static_assert((V256(~0ull) + 1) == (V256(1) << 64));
+static_assert(((V256(1) << 192) - 1).limb(0) == ~0ull);
+static_assert(((V256(1) << 192) - 1).limb(2) == ~0ull);
+static_assert(((V256(1) << 192) - 1).limb(3) == 0);
+static_assert(((V256(0) - 1) >> 255) == 1);
+static_assert((V512(0) - 1) + 1 == 0);
+
+// shifts across limbs
+static_assert(((V256(5) << 150) >> 150) == 5);
+static_assert((V256(3) << 63).limb(1) == 1);
+static_assert(((V256(5) << 192) >> 129).limb(0) == 1ull << 63);
+static_assert(((V256(5) << 192) >> 129).limb(1) == 2);
+static_assert((V512(1) << 511).limb(7) == 1ull << 63);
+
+static_assert(lsbIndex(V256(1) << 130) == 130);
+static_assert(msbIndex((V256(1) << 130) | 1) == 130);
+static_assert(lsbIndex(V256(0)) == 256);
+
+static_assert(
+    (V256(3) << 100) * (V256(5) << 100) == (V256(15) << 200)
+);
+
+// SWAR with the same interface and constants
+using S8_256 = SWAR<8, V256>;
+static_assert(32 == S8_256::Lanes);
+static_assert(1 == S8_256{S8_256::LeastSignificantBit}.at(31));
+static_assert(0x80 == S8_256{S8_256::MostSignificantBit}.at(17));
+static_assert(7 == broadcast(S8_256{V256(7)}).at(31));
+static_assert(0x80 == BooleanSWAR<8, V256>::MaskMSB.at(30));
+static_assert(
+    20 ==
+    equals(
+        S8_256{V256(7) << 8 * 20},
+        S8_256{S8_256::LeastSignificantBit | (V256(7) << 8 * 20)}
+    ).lsbIndex()
+);
+static_assert(
+    10 ==
+    greaterEqual_MSB_off(
+        S8_256{V256(0x7F) << 8 * 10},
+        S8_256{S8_256::LeastSignificantBit | (V256(0x10) << 8 * 10)}
+    ).lsbIndex()
+);
+static_assert(
+    1 == SWARWithSubLanes<5, 3, V256>::LeastOnes.at(31)
+);
+
+namespace {
+
+/// Same algorithm as \c c_strLength, for a block type \c T
+template<typename T>
+std::size_t nullIndex(const char *s) {
+    using S = SWAR<8, T>;
+    constexpr auto Ones = S{S::LeastSignificantBit};
+    for(auto base = s;; base += sizeof(T)) {
+        S bytes;
+        memcpy(&bytes.m_v, base, sizeof(T));
+        auto firstNull = convertToBooleanSWAR((bytes - Ones) & ~bytes);
+        if(firstNull) { return base - s + firstNull.lsbIndex(); }
+    }
+}
+
+}
+
+TEST_CASE("Vector register arithmetic", "[swar][vector]") {
+    std::mt19937_64 g(128);
+    auto random128 = [&]() { return (__uint128_t(g()) << 64) | g(); };
+    auto asVector = [](__uint128_t v) {
+        return (V128(std::uint64_t(v >> 64)) << 64) | V128(std::uint64_t(v));
+    };
+    for(auto count = 10000; count--; ) {
+        auto a = random128(), b = random128();
+        // makes runs of limbs with all bits set or clear to chain the carries
+        if(count % 3 == 0) { b = ~a; }
+        auto shift = int(g() % 128);
+        auto va = asVector(a), vb = asVector(b);
+        CHECK(asVector(a + b) == va + vb);
+        CHECK(asVector(a - b) == va - vb);
+        CHECK(asVector(a * b) == va * vb);
+        CHECK(asVector(a << shift) == (va << shift));
+        CHECK(asVector(a >> shift) == (va >> shift));
+    }
+}
+
+TEST_CASE("Vector register strlen", "[swar][vector]") {
+    alignas(64) char buffer[192];
+    memset(buffer, 'a', sizeof(buffer));
+    for(std::size_t position = 0; position < 128; ++position) {
+        buffer[position] = '\0';
+        // the bytes before the null have all the values, for borrows
+        for(std::size_t before = 0; before < position; ++before) {
+            buffer[before] = char(1 + (before * 37) % 255);
+        }
+        REQUIRE(position == nullIndex<std::uint64_t>(buffer));
+        REQUIRE(position == nullIndex<V128>(buffer));
+        REQUIRE(position == nullIndex<V256>(buffer));
+        REQUIRE(position == nullIndex<V512>(buffer));
+        buffer[position] = 'a';
+    }
+}
@@ -0,0 +1,110 @@
+#include "zoo/swar/WideSWAR.h"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+using W8 = WideSWAR<8, 4>;
+using W5 = WideSWAR<5, 2>;
+
+static_assert(32 == W8::Lanes && 24 == W5::Lanes);
+static_assert(0x22 == W8{{0x11, 0x22, 0x33, 0x44}}.at(8));
+static_assert(0x44 == W8{{0x11, 0x22, 0x33, 0x44}}.at(24));
+static_assert(0x1F == W5{{0, 0x1F}}.at(12));
+// the lanes move across words, the padding does not enter the lanes
+static_assert(0x11 == W8{{0x11'00'00'00'00'00'00'00, 0}}.shiftLanesLeft(1).words()[1]);
+static_assert(0x1100 == W8{{0x11'00'00'00'00'00'00'00, 0}}.shiftLanesLeft(2).words()[1]);
+static_assert(0x11 == W8{{0, 0, 0, 0x11}}.shiftLanesLeft(0).words()[3]);
+static_assert(0x22'00'00'00'00'00'00'00 == W8{{0, 0x22}}.shiftLanesRight(1).words()[0]);
+static_assert(0x1F == W5{{0x0F80'0000'0000'0000, 0}}.shiftLanesLeft(1).words()[1]);
+static_assert(0x0F80'0000'0000'0000 == W5{{0xF000'0000'0000'0000, 0x1F}}.shiftLanesRight(1).words()[0]);
+static_assert(19 == W8{{0, 0, 0x0100'0000, 0x1}}.lsbIndex());
+static_assert(24 == W8{{0, 0, 0x0100'0000, 0x1}}.top());
+static_assert(24 == W5{{0xF000'0000'0000'0000, 0}}.lsbIndex());
+static_assert(-1 == W5{{0xF000'0000'0000'0000, 0}}.top());
+static_assert(!W5{{0xF000'0000'0000'0000, 0}});
+static_assert(0x0707'0707'0707'0707 == broadcast(W8{{7}}).words()[3]);
+static_assert(0x80 == equals(W8{{0, 0, 0x1234}}, W8{{1, 1, 0x5634}}).at(16));
+static_assert(0 == equals(W8{{0, 0, 0x1234}}, W8{{1, 1, 0x5634}}).at(17));
+static_assert(0x12 == maximum(W8{{0, 0, 0x12}}, W8{{1, 1, 0x11}}).at(16));
+
+namespace {
+
+template<typename W>
+std::vector<uint64_t> lanes(W w) {
+    std::vector<uint64_t> rv(W::Lanes);
+    for(auto lane = 0; lane < W::Lanes; ++lane) { rv[lane] = w.at(lane); }
+    return rv;
+}
+
+template<typename W>
+W fromLanes(const std::vector<uint64_t> &values) {
+    W rv{};
+    for(auto lane = 0; lane < W::Lanes; ++lane) {
+        rv = rv.blitElement(lane, values[lane]);
+    }
+    return rv;
+}
+
+template<typename W>
+void check(std::mt19937_64 &g) {
+    using Word = typename W::Word;
+    for(auto count = 100; count--; ) {
+        typename W::Words a, b;
+        for(auto &w: a) { w = g(); }
+        for(auto &w: b) { w = g(); }
+        // sparse lanes to find the first and last
+        if(count % 2) {
+            for(auto &w: a) { w &= g() & g() & g() & g(); }
+        }
+        W x{a}, y{b};
+        auto xLanes = lanes(x);
+        for(auto shift = 0; shift <= W::Lanes; ++shift) {
+            // the counts within a word, across all the words, and a sample
+            auto sampled =
+                shift <= W::LanesPerWord + 1 || W::Lanes == shift ||
+                0 == g() % 16;
+            if(!sampled) { continue; }
+            auto left = lanes(x.shiftLanesLeft(shift)),
+                right = lanes(x.shiftLanesRight(shift));
+            for(auto lane = 0; lane < W::Lanes; ++lane) {
+                auto from = lane - shift;
+                CHECK((0 <= from ? xLanes[from] : 0) == left[lane]);
+                from = lane + shift;
+                CHECK((from < W::Lanes ? xLanes[from] : 0) == right[lane]);
+            }
+        }
+        auto first = 0;
+        while(first < W::Lanes && 0 == xLanes[first]) { ++first; }
+        auto last = W::Lanes - 1;
+        while(0 <= last && 0 == xLanes[last]) { --last; }
+        CHECK(first == x.lsbIndex());
+        CHECK(last == x.top());
+        CHECK((first < W::Lanes) == bool(x));
+        CHECK(fromLanes<W>(xLanes).lsbIndex() == first);
+        auto ge = greaterEqual(x, y), max = maximum(x, y), sum = x + y;
+        auto chosen = select(ge, x, y);
+        for(auto i = 0; i < W::WordCount; ++i) {
+            CHECK(greaterEqual(Word{a[i]}, Word{b[i]}).value() == ge.words()[i]);
+            CHECK(maximum(Word{a[i]}, Word{b[i]}).value() == max.words()[i]);
+            CHECK((a[i] + b[i]) == sum.words()[i]);
+        }
+        CHECK(lanes(max) == lanes(chosen));
+    }
+}
+
+}
+
+TEST_CASE("SWARs of several words", "[swar]") {
+    std::mt19937_64 g(48);
+    check<WideSWAR<8, 4>>(g);
+    check<WideSWAR<1, 16>>(g);
+    check<WideSWAR<5, 4>>(g);
+    check<WideSWAR<12, 3>>(g);
+    check<WideSWAR<16, 1>>(g);
+    check<WideSWAR<64, 5>>(g);
+}
@@ -0,0 +1,271 @@
+#include "zoo/swar/arithmetic.h"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+#include <utility>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+static_assert(0x00'FF'7F'01 == fullSubtraction(SWAR<8, u32>{0x05'00'80'03}, SWAR<8, u32>{0x05'01'01'02}).result.value());
+static_assert(0x00'80'00'00 == fullSubtraction(SWAR<8, u32>{0x05'00'80'03}, SWAR<8, u32>{0x05'01'01'02}).carry.value());
+// -128 - 1 overflows
+static_assert(0x00'00'80'00 == fullSubtraction(SWAR<8, u32>{0x05'00'80'03}, SWAR<8, u32>{0x05'01'01'02}).overflow.value());
+static_assert(0x00'00'7F'01 == saturatingUnsignedSubtraction(SWAR<8, u32>{0x05'00'80'03}, SWAR<8, u32>{0x05'01'01'02}).value());
+// 100 + 100 -> 127, -100 + -100 -> -128, -1 + 1 -> 0
+static_assert(0x7F'80'00 == saturatingSignedAddition(SWAR<8, u32>{0x64'9C'FF}, SWAR<8, u32>{0x64'9C'01}).value());
+// 100 - -100 -> 127, -100 - 100 -> -128, 0 - -128 -> 127
+static_assert(0x7F'80'7F == saturatingSignedSubtraction(SWAR<8, u32>{0x64'9C'00}, SWAR<8, u32>{0x9C'64'80}).value());
+static_assert(0x80'00 == signedGreaterEqual(SWAR<8, u16>{0x01'FF}, SWAR<8, u16>{0xFF'01}).value());
+static_assert(0x80'80 == greaterEqual(SWAR<8, u16>{0xFF'01}, SWAR<8, u16>{0x01'01}).value());
+static_assert(0xFF'01 == maximum(SWAR<8, u16>{0xFF'01}, SWAR<8, u16>{0x01'00}).value());
+static_assert(0x01'00 == minimum(SWAR<8, u16>{0xFF'01}, SWAR<8, u16>{0x01'00}).value());
+static_assert(0x01'01 == signedMaximum(SWAR<8, u16>{0xFF'01}, SWAR<8, u16>{0x01'00}).value());
+static_assert(0xFF'00 == signedMinimum(SWAR<8, u16>{0xFF'01}, SWAR<8, u16>{0x01'00}).value());
+static_assert(0x80'FF'02 == roundingAverage(SWAR<8, u32>{0xFF'FF'01}, SWAR<8, u32>{0x00'FF'02}).value());
+static_assert(0xFF'00'01 == absoluteDifference(SWAR<8, u32>{0xFF'FF'01}, SWAR<8, u32>{0x00'FF'02}).value());
+static_assert(0xF'0'E'2 == absoluteDifference(SWAR<4, u16>{0xF'3'0'2}, SWAR<4, u16>{0x0'3'E'4}).value());
+// 0x63 / 10, 0x2A / 10, 0xFF / 10, 7 / 10
+static_assert(0x09'04'19'00 == divideByConstant<10>(SWAR<8, u32>{0x63'2A'FF'07}).value());
+static_assert(0x09'02'05'07 == moduloByConstant<10>(SWAR<8, u32>{0x63'2A'FF'07}).value());
+static_assert(0x0E'06'24'01 == divideByConstant<7>(SWAR<8, u32>{0x63'2A'FF'07}).value());
+static_assert(0x01'00'03'00 == moduloByConstant<7>(SWAR<8, u32>{0x63'2A'FF'07}).value());
+static_assert(0x0C'05'1F'00 == divideByConstant<8>(SWAR<8, u32>{0x63'2A'FF'07}).value());
+static_assert(0x03'02'07'07 == moduloByConstant<8>(SWAR<8, u32>{0x63'2A'FF'07}).value());
+static_assert(0 == divideByConstant<256>(SWAR<8, u32>{0x63'2A'FF'07}).value());
+static_assert(0x1999 == divideByConstant<10>(SWAR<16, u32>{0xFFFF}).value());
+// 1*3, 3*4, 7*5, 15*6 with 7 = 8 - 1 and 15 = 16 - 1
+static_assert(0x03'0C'23'5A == constantMultiplication_OverflowUnsafe<0x01'03'07'0F>(SWAR<8, u32>{0x03'04'05'06}).value());
+static_assert(0x0A'14'1E'28 == constantMultiplication_OverflowUnsafe<0x0A'0A'0A'0A>(SWAR<8, u32>{0x01'02'03'04}).value());
+static_assert(0x0'0'F'E == constantMultiplication_OverflowUnsafe<0x0'1'5'E>(SWAR<4, u16>{0x7'0'3'1}).value());
+
+namespace {
+
+using Wide = __int128;
+
+/// The lane-wise results compared to the same operations on integers wide
+/// enough not to overflow
+template<typename S>
+struct Reference {
+    using T = typename S::type;
+    constexpr static Wide
+        Modulo = Wide(1) << S::NBits,
+        Max = Modulo / 2 - 1,
+        Min = -Modulo / 2;
+
+    static Wide toSigned(Wide v) { return Max < v ? v - Modulo : v; }
+    static T encode(Wide v) { return T(((v % Modulo) + Modulo) % Modulo); }
+    static Wide clamp(Wide v, Wide low, Wide high) {
+        return v < low ? low : high < v ? high : v;
+    }
+
+    static void check(S x, S y) {
+        auto subtraction = fullSubtraction(x, y);
+        auto
+            uSubtraction = saturatingUnsignedSubtraction(x, y),
+            sAddition = saturatingSignedAddition(x, y),
+            sSubtraction = saturatingSignedSubtraction(x, y),
+            max = maximum(x, y), min = minimum(x, y),
+            sMax = signedMaximum(x, y), sMin = signedMinimum(x, y),
+            average = roundingAverage(x, y),
+            difference = absoluteDifference(x, y);
+        auto sGreaterEqual = signedGreaterEqual(x, y);
+        for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+            Wide a = x.at(lane), b = y.at(lane);
+            auto sa = toSigned(a), sb = toSigned(b);
+            auto flag = [&](auto booleans) {
+                return 0 != booleans.at(lane);
+            };
+            CHECK(encode(a - b) == subtraction.result.at(lane));
+            CHECK((a < b) == flag(subtraction.carry));
+            CHECK((sa - sb < Min || Max < sa - sb) == flag(subtraction.overflow));
+            CHECK(encode(a < b ? 0 : a - b) == uSubtraction.at(lane));
+            CHECK(encode(clamp(sa + sb, Min, Max)) == sAddition.at(lane));
+            CHECK(encode(clamp(sa - sb, Min, Max)) == sSubtraction.at(lane));
+            CHECK((sb <= sa) == flag(sGreaterEqual));
+            CHECK(encode(a < b ? b : a) == max.at(lane));
+            CHECK(encode(a < b ? a : b) == min.at(lane));
+            CHECK(encode(sa < sb ? sb : sa) == sMax.at(lane));
+            CHECK(encode(sa < sb ? sa : sb) == sMin.at(lane));
+            CHECK(encode((a + b + 1) / 2) == average.at(lane));
+            CHECK(encode(a < b ? b - a : a - b) == difference.at(lane));
+        }
+    }
+};
+
+/// \c blitElement of a value shifts all the bits for lanes of the full width
+template<typename S>
+S withLane(S s, int lane, typename S::type value) {
+    auto shift = lane * S::NBits;
+    auto mask = S{typename S::type(S::LeastSignificantLaneMask << shift)};
+    return (s & ~mask) | S{typename S::type(value << shift)};
+}
+
+/// All the pairs of lane values, a pair per lane
+template<typename S>
+void checkExhaustively() {
+    using T = typename S::type;
+    constexpr auto Values = T(1) << S::NBits;
+    S x{0}, y{0};
+    auto lane = 0;
+    for(T a = 0; a < Values; ++a) {
+        for(T b = 0; b < Values; ++b) {
+            x = withLane(x, lane, a);
+            y = withLane(y, lane, b);
+            if(int(S::Lanes) == ++lane) {
+                Reference<S>::check(x, y);
+                lane = 0;
+            }
+        }
+    }
+    if(lane) { Reference<S>::check(x, y); }
+}
+
+/// Random lanes, half of them replaced by the values at the extremes
+template<typename S>
+void checkRandomly(std::mt19937_64 &g) {
+    using T = typename S::type;
+    const T Extremes[] = {
+        0, 1, T(S::MostSignificantBit & S::LeastSignificantLaneMask),
+        T(S::LowerBits & S::LeastSignificantLaneMask),
+        T(S::LeastSignificantLaneMask)
+    };
+    auto lane = [&]() -> T {
+        auto r = g();
+        if(r & 1) { return Extremes[(r >> 1) % 5]; }
+        return T(r >> 8) & T(S::LeastSignificantLaneMask);
+    };
+    for(auto count = 2000; count--; ) {
+        S x{0}, y{0};
+        for(auto i = 0; i < int(S::Lanes); ++i) {
+            x = withLane(x, i, lane());
+            y = withLane(y, i, lane());
+        }
+        Reference<S>::check(x, y);
+    }
+}
+
+template<uint64_t Divisor, typename S>
+void checkDivision(S dividend) {
+    auto quotient = divideByConstant<Divisor>(dividend);
+    auto remainder = moduloByConstant<Divisor>(dividend);
+    for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+        uint64_t v = dividend.at(lane);
+        CHECK(v / Divisor == quotient.at(lane));
+        CHECK(v % Divisor == remainder.at(lane));
+    }
+}
+
+/// All the dividends, a lane each
+template<uint64_t Divisor, typename S>
+void checkDivisionExhaustively() {
+    using T = typename S::type;
+    S dividend{0};
+    auto lane = 0;
+    for(uint64_t v = 0; v <= S::MaxUnsignedLaneValue; ++v) {
+        dividend = withLane(dividend, lane, T(v));
+        if(int(S::Lanes) == ++lane) {
+            checkDivision<Divisor>(dividend);
+            lane = 0;
+        }
+    }
+}
+
+template<typename S, uint64_t... Divisors>
+void checkAllDividends(std::integer_sequence<uint64_t, Divisors...>) {
+    // the divisors from 1 up to 2 beyond the maximum of the lane
+    (checkDivisionExhaustively<Divisors + 1, S>(), ...);
+}
+
+template<typename S, uint64_t... Divisors>
+void checkRandomDividends(std::mt19937_64 &g) {
+    using T = typename S::type;
+    for(auto count = 1000; count--; ) {
+        S dividend{T(g())};
+        (checkDivision<Divisors>(dividend), ...);
+    }
+}
+
+}
+
+TEST_CASE("Lane-wise arithmetic, all the pairs of values", "[swar]") {
+    checkExhaustively<SWAR<2, u8>>();
+    checkExhaustively<SWAR<4, u8>>();
+    checkExhaustively<SWAR<4, u64>>();
+    checkExhaustively<SWAR<8, u16>>();
+    checkExhaustively<SWAR<8, u64>>();
+    checkExhaustively<SWAR<3, u16>>();
+    checkExhaustively<SWAR<5, u64>>();
+    checkExhaustively<SWAR<7, u32>>();
+}
+
+TEST_CASE("Lane-wise arithmetic, wide lanes", "[swar]") {
+    std::mt19937_64 g(40);
+    checkRandomly<SWAR<16, u64>>(g);
+    checkRandomly<SWAR<32, u64>>(g);
+    checkRandomly<SWAR<64, u64>>(g);
+    checkRandomly<SWAR<16, u32>>(g);
+    checkRandomly<SWAR<12, u64>>(g);
+    checkRandomly<SWAR<8, u64>>(g);
+}
+
+namespace {
+
+/// The exact sum of the products shifted to their lanes, modulo the width
+/// of the type
+template<uint64_t Multipliers, typename S>
+void checkConstantMultiplication(S x) {
+    using T = typename S::type;
+    S multipliers{T(Multipliers)};
+    __uint128_t expected = 0;
+    for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+        expected +=
+            (__uint128_t(x.at(lane)) * multipliers.at(lane)) << (lane * S::NBits);
+    }
+    CHECK(T(expected) == constantMultiplication_OverflowUnsafe<Multipliers>(x).value());
+}
+
+template<typename S, uint64_t... Multipliers>
+void checkConstantMultiplications(std::mt19937_64 &g) {
+    using T = typename S::type;
+    for(auto count = 1000; count--; ) {
+        auto r = g();
+        // half of the multiplicands small enough for the products to fit
+        S x{T(count & 1 ? r : r & (S::LeastSignificantBit * 0xF))};
+        (checkConstantMultiplication<Multipliers>(x), ...);
+    }
+}
+
+}
+
+TEST_CASE("Multiplication by constants", "[swar]") {
+    std::mt19937_64 g(43);
+    checkConstantMultiplications<
+        SWAR<8, u64>,
+        0x01'03'07'0F'1F'3F'7F'FF, 0x00'01'02'03'04'05'06'07,
+        0x55'AA'CC'33'0B'0D'11'13, 0x0A'0A'0A'0A'0A'0A'0A'0A
+    >(g);
+    checkConstantMultiplications<SWAR<8, u32>, 0x01'02'03'04, 0xFF'80'7F'81>(g);
+    checkConstantMultiplications<SWAR<4, u16>, 0xF'7'3'1, 0x5'B'D'0>(g);
+    checkConstantMultiplications<SWAR<2, u8>, 0b11'10'01'00>(g);
+    checkConstantMultiplications<SWAR<16, u64>, 0x0001'00FF'7FFF'FFFF, 0x1234'5678'9ABC'DEF0>(g);
+    checkConstantMultiplications<SWAR<32, u64>, 0x0000'0007'FFFF'FFFF>(g);
+    checkConstantMultiplications<SWAR<3, u16>, 0b0'111'110'101'011'001>(g);
+    checkConstantMultiplications<SWAR<64, u64>, 0xFFFF'FFFF'FFFF'FFFF>(g);
+}
+
+TEST_CASE("Division and modulo by constants", "[swar]") {
+    checkAllDividends<SWAR<8, u64>>(std::make_integer_sequence<uint64_t, 257>{});
+    checkAllDividends<SWAR<4, u32>>(std::make_integer_sequence<uint64_t, 17>{});
+    std::mt19937_64 g(42);
+    checkRandomDividends<
+        SWAR<16, u64>, 3, 7, 10, 60, 100, 641, 1000, 4096, 10000, 65535, 65537
+    >(g);
+    checkRandomDividends<SWAR<16, u32>, 7, 10, 255, 3600>(g);
+    checkRandomDividends<SWAR<8, u16>, 3, 7, 10, 100, 255>(g);
+    checkRandomDividends<SWAR<2, u8>, 1, 2, 3, 4>(g);
+    checkRandomDividends<
+        SWAR<32, u64>, 3, 7, 10, 1000, 86400, 1'000'000'007, 0xFFFF'FFFF
+    >(g);
+}
@@ -0,0 +1,90 @@
+#include "zoo/swar/bits.h"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+static_assert(0x00'01'07'08 == clzLanes(SWAR<8, u32>{0x80'40'01'00}).value());
+static_assert(0x07'06'00'08 == ctzLanes(SWAR<8, u32>{0x80'40'01'00}).value());
+static_assert(0x08'04'01'00 == popcountLanes(SWAR<8, u32>{0xFF'0F'80'00}).value());
+static_assert(0x0'1'2'4 == popcountLanes(SWAR<4, u16>{0x0'8'A'F}).value());
+static_assert(0x01'02'80'C0 == reverseBitsInLanes(SWAR<8, u32>{0x80'40'01'03}).value());
+static_assert(0x1'2'8'C == reverseBitsInLanes(SWAR<4, u16>{0x8'4'1'3}).value());
+static_assert(0x3412'7856 == byteSwapLanes(SWAR<16, u32>{0x1234'5678}).value());
+static_assert(0x7856'3412 == byteSwapLanes(SWAR<32, u32>{0x1234'5678}).value());
+static_assert(0x4433'2211'8877'6655 == byteSwapLanes(SWAR<32, u64>{0x1122'3344'5566'7788}).value());
+
+namespace {
+
+/// The operations on the lane value compared with the builtins of the
+/// compiler on the value of the lane
+template<typename S>
+void checkLanes(S input) {
+    constexpr auto NB = S::NBits;
+    auto
+        leading = clzLanes(input),
+        trailing = ctzLanes(input),
+        population = popcountLanes(input),
+        reversed = reverseBitsInLanes(input);
+    for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+        uint64_t v = input.at(lane);
+        // the lane aligned to the most significant bit
+        auto high = v << (64 - NB);
+        uint64_t reference = 0;
+        for(auto bit = 0; bit < int(NB); ++bit) {
+            reference |= ((v >> bit) & 1) << (NB - 1 - bit);
+        }
+        CHECK(uint64_t(v ? __builtin_clzll(high) : NB) == leading.at(lane));
+        CHECK(uint64_t(v ? __builtin_ctzll(v) : NB) == trailing.at(lane));
+        CHECK(uint64_t(__builtin_popcountll(v)) == population.at(lane));
+        CHECK(reference == reversed.at(lane));
+        if constexpr(0 == NB % 8) {
+            auto swapped = byteSwapLanes(input);
+            CHECK((__builtin_bswap64(v) >> (64 - NB)) == swapped.at(lane));
+        }
+    }
+}
+
+template<typename S>
+void checkAllLaneValues() {
+    using T = typename S::type;
+    for(uint64_t v = 0; v <= S::MaxUnsignedLaneValue; ++v) {
+        // the value in all the lanes, and neighbors that differ
+        auto all = S{T(v * S::LeastSignificantBit)};
+        checkLanes(all);
+        checkLanes(S{T(all.value() ^ T(0x5A5A'5A5A'5A5A'5A5Aull))});
+    }
+}
+
+template<typename S>
+void checkRandomly(std::mt19937_64 &g) {
+    using T = typename S::type;
+    for(auto count = 10000; count--; ) {
+        auto r = g();
+        // one in four with runs of zeros at the sides of the lanes
+        if(0 == count % 4) { r &= g() >> (count % 64); }
+        checkLanes(S{T(r)});
+    }
+}
+
+}
+
+TEST_CASE("Bit counts and permutations of the lanes", "[swar]") {
+    checkAllLaneValues<SWAR<4, u64>>();
+    checkAllLaneValues<SWAR<4, u16>>();
+    checkAllLaneValues<SWAR<8, u64>>();
+    checkAllLaneValues<SWAR<8, u32>>();
+    checkAllLaneValues<SWAR<8, u16>>();
+    checkAllLaneValues<SWAR<16, u64>>();
+    checkAllLaneValues<SWAR<16, u32>>();
+    std::mt19937_64 g(44);
+    checkRandomly<SWAR<2, u64>>(g);
+    checkRandomly<SWAR<32, u64>>(g);
+    checkRandomly<SWAR<64, u64>>(g);
+    checkRandomly<SWAR<32, u32>>(g);
+    checkRandomly<SWAR<16, u16>>(g);
+    checkRandomly<SWAR<8, u8>>(g);
+}
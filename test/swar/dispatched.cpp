@@ -0,0 +1,50 @@
+#include "zoo/swar/dispatched.h"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+namespace {
+
+template<int NB>
+void checkCompressions(std::mt19937_64 &g) {
+    using S = SWAR<NB, uint64_t>;
+    for(auto count = 1000; count--; ) {
+        S input{g()}, mask{g()};
+        auto compressed = compress(input, mask).value();
+        auto expanded = expand(input, mask).value();
+        CHECK(compressed == compressDispatched(input, mask).value());
+        CHECK(expanded == expandDispatched(input, mask).value());
+        #if ZOO_CAN_DISPATCH_TO_X86_EXTENSIONS()
+        if(cpuFeatures().bmi2) {
+            auto i = input.value(), m = mask.value();
+            CHECK(compressed == impl::lanewiseBMI2<NB, false>(i, m));
+            CHECK(expanded == impl::lanewiseBMI2<NB, true>(i, m));
+        }
+        #endif
+    }
+}
+
+}
+
+TEST_CASE("Dispatched compress and expand", "[swar][dispatch]") {
+    std::mt19937_64 g(36);
+    #define X(nb) checkCompressions<nb>(g);
+    X(4) X(8) X(16) X(32) X(64)
+    #undef X
+}
+
+TEST_CASE("Detected CPU features are stable", "[dispatch]") {
+    auto &features = cpuFeatures();
+    auto detected = detectCPUFeatures();
+    CHECK(features.bmi2 == detected.bmi2);
+    CHECK(features.avx2 == detected.avx2);
+    CHECK(features.avx512bw == detected.avx512bw);
+    // the baseline the compilation assumes is supported
+    #if ZOO_CONFIGURED_TO_USE_AVX()
+    CHECK(features.avx2);
+    #endif
+}
@@ -0,0 +1,161 @@
+#include "zoo/swar/encodings.h"
+
+#include "catch2/catch.hpp"
+
+#include <cctype>
+#include <cstring>
+#include <random>
+#include <string>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+static_assert(0x0A0B'0C0D == impl::spreadFields<4, 8, 4>(0xABCD));
+static_assert(0xABCD == impl::gatherFields<4, 8, 1>(0x0A0B'0C0D));
+static_assert(
+    0x3F'00'3F'00'3F'00'3F'00 ==
+        impl::spreadFields<6, 8, 4>(0b111111'000000'111111'000000'111111'000000'111111'000000)
+);
+// "0123abcd", the digits of 0x01, 0x23, 0xAB, 0xCD in memory order
+static_assert(0x6463'6261'3332'3130 == impl::hexDigits(0xCDAB'2301));
+// "TWFu" of "Man", with the first sextets of zeros
+static_assert(0x4141'7546'5754 == (impl::base64Characters(0x6E614D) & 0xFFFF'FFFF'FFFF));
+
+namespace {
+
+const char HexDigits[] = "0123456789abcdef";
+const char Base64Alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string scalarEncodeHex(const std::string &bytes) {
+    std::string rv;
+    for(unsigned char c: bytes) {
+        rv += HexDigits[c >> 4];
+        rv += HexDigits[c & 0xF];
+    }
+    return rv;
+}
+
+std::string scalarEncodeBase64(const std::string &bytes) {
+    std::string rv;
+    for(std::size_t i = 0; i < bytes.size(); i += 3) {
+        auto remaining = bytes.size() - i;
+        unsigned group = (unsigned char)bytes[i] << 16;
+        if(1 < remaining) { group |= (unsigned char)bytes[i + 1] << 8; }
+        if(2 < remaining) { group |= (unsigned char)bytes[i + 2]; }
+        for(auto sextet = 0; sextet < 4; ++sextet) {
+            rv +=
+                sextet <= int(remaining) ?
+                    Base64Alphabet[(group >> (18 - 6 * sextet)) & 0x3F] :
+                    '=';
+        }
+    }
+    return rv;
+}
+
+std::string randomBytes(std::mt19937_64 &g, std::size_t size) {
+    std::string rv(size, '\0');
+    for(auto &c: rv) { c = char(g()); }
+    return rv;
+}
+
+std::string hexOf(const std::string &bytes) {
+    std::string rv(hexEncodedSize(bytes.size()), '\0');
+    CHECK(rv.size() == encodeHex(bytes, rv));
+    return rv;
+}
+
+std::string base64Of(const std::string &bytes) {
+    std::string rv(base64EncodedSize(bytes.size()), '\0');
+    CHECK(rv.size() == encodeBase64(bytes, rv));
+    return rv;
+}
+
+/// The decoded bytes, or "invalid"
+template<typename Decoder>
+std::string decode(Decoder &&decoder, const std::string &text) {
+    std::string rv(text.size(), '\0');
+    auto count = decoder(ByteSpan(text), MutableByteSpan(rv));
+    if(InvalidEncoding == count) { return "invalid"; }
+    rv.resize(count);
+    return rv;
+}
+
+std::string fromHex(const std::string &text) {
+    return decode([](auto in, auto out) { return decodeHex(in, out); }, text);
+}
+
+std::string fromBase64(const std::string &text) {
+    return decode([](auto in, auto out) { return decodeBase64(in, out); }, text);
+}
+
+}
+
+TEST_CASE("Hexadecimal encoding and decoding", "[swar][ranges]") {
+    CHECK("" == hexOf(""));
+    CHECK("00ff7f80" == hexOf(std::string("\x00\xFF\x7F\x80", 4)));
+    CHECK(std::string("\x01\x23\xAB\xCD", 4) == fromHex("0123abCD"));
+    CHECK("invalid" == fromHex("012"));
+    CHECK("invalid" == fromHex("0g"));
+    CHECK("invalid" == fromHex("0123456789abcdef0:"));
+    CHECK("invalid" == fromHex("@0"));
+    CHECK("invalid" == fromHex("`0"));
+    CHECK("invalid" == fromHex("\xB0" "0"));
+
+    std::mt19937_64 g(50);
+    for(std::size_t size = 0; size < 40; ++size) {
+        for(auto repetition = 10; repetition--; ) {
+            auto bytes = randomBytes(g, size);
+            auto encoded = hexOf(bytes);
+            REQUIRE(scalarEncodeHex(bytes) == encoded);
+            CHECK(bytes == fromHex(encoded));
+            if(encoded.empty()) { continue; }
+            auto position = g() % encoded.size();
+            auto corrupted = encoded;
+            corrupted[position] = char(g());
+            bool isDigit = std::isxdigit((unsigned char)corrupted[position]);
+            CHECK(isDigit == ("invalid" != fromHex(corrupted)));
+        }
+    }
+}
+
+TEST_CASE("Base64 encoding and decoding", "[swar][ranges]") {
+    // RFC 4648, 10. Test Vectors
+    const char *Vectors[][2] = {
+        { "", "" }, { "f", "Zg==" }, { "fo", "Zm8=" }, { "foo", "Zm9v" },
+        { "foob", "Zm9vYg==" }, { "fooba", "Zm9vYmE=" },
+        { "foobar", "Zm9vYmFy" }
+    };
+    for(auto &[bytes, encoded]: Vectors) {
+        CHECK(encoded == base64Of(bytes));
+        CHECK(bytes == fromBase64(encoded));
+    }
+    CHECK("invalid" == fromBase64("Zm9"));
+    CHECK("invalid" == fromBase64("Z==="));
+    CHECK("invalid" == fromBase64("Zm=v"));
+    CHECK("invalid" == fromBase64("Zm9vYmFy-A=="));
+
+    std::mt19937_64 g(64);
+    for(std::size_t size = 0; size < 40; ++size) {
+        for(auto repetition = 10; repetition--; ) {
+            auto bytes = randomBytes(g, size);
+            auto encoded = base64Of(bytes);
+            REQUIRE(scalarEncodeBase64(bytes) == encoded);
+            CHECK(bytes == fromBase64(encoded));
+            if(encoded.empty()) { continue; }
+            auto dataCharacters = encoded.find('=');
+            if(std::string::npos == dataCharacters) {
+                dataCharacters = encoded.size();
+            }
+            auto position = g() % dataCharacters;
+            auto corrupted = encoded;
+            corrupted[position] = char(g());
+            // a padding instead of the last characters may be valid
+            if('=' == corrupted[position]) { continue; }
+            auto inAlphabet =
+                '\0' != corrupted[position] &&
+                nullptr != strchr(Base64Alphabet, corrupted[position]);
+            CHECK(inAlphabet == ("invalid" != fromBase64(corrupted)));
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#include "zoo/swar/arithmetic.h"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+using S5 = SWAR<5, u64>;
+using S12 = SWAR<12, u64>;
+
+// 12 lanes of 5 bits and 4 bits of padding, 5 lanes of 12 bits and 4 bits
+static_assert(12 == S5::Lanes && 4 == S5::PaddingBitsCount);
+static_assert(5 == S12::Lanes && 4 == S12::PaddingBitsCount);
+static_assert(0x0084'2108'4210'8421 == S5::LeastSignificantBit);
+static_assert(0x0842'1084'2108'4210 == S5::MostSignificantBit);
+static_assert(0x07BD'EF7B'DEF7'BDEF == S5::LowerBits);
+static_assert(0x0001'0010'0100'1001 == S12::LeastSignificantBit);
+static_assert(0x07FF'7FF7'FF7F'F7FF == S12::LowerBits);
+static_assert(0x1249 == SWAR<3, u16>::LeastSignificantBit);
+static_assert(0x0001'0010'0100'1001 == BooleanSWAR<12, u64>::MaskLSB.value());
+static_assert(0x0ABC'ABCA'BCAB'CABC == broadcast(S12{0xABC}).value());
+static_assert(0x0739'CE73'9CE7'39CE == broadcast(S5{0xE}).value());
+// the padding bits do not enter the lanes nor are set by the shifts
+static_assert(0 == S12{0xF000'0000'0000'0000}.shiftLanesRight(0).value());
+static_assert(0x0000'FFFF'FFFF'FFFF == S12{0xFFFF'FFFF'FFFF'FFFF}.shiftLanesRight(1).value());
+static_assert(0x0FFF'FFFF'FFFF'F000 == S12{0x0FFF'FFFF'FFFF'FFFF}.shiftLanesLeft(1).value());
+static_assert(5 == S12{0xF000'0000'0000'0000}.lsbIndex());
+static_assert(4 == S12{0xF800'0000'0000'0000}.lsbIndex());
+static_assert(2 == S12{0xF000'0000'0100'0000}.top());
+static_assert(12 == S5{0}.lsbIndex());
+
+namespace {
+
+/// The lanes of the results of the operations do not depend on the padding
+/// bits of the operands, and are the lane-wise results
+template<typename S>
+void checkPaddingIsIgnored(std::mt19937_64 &g) {
+    using T = typename S::type;
+    constexpr auto Padding = T(~S::AllOnes);
+    constexpr auto Modulo = uint64_t(S::MaxUnsignedLaneValue) + 1;
+    for(auto count = 5000; count--; ) {
+        auto a = T(g()), b = T(g());
+        S x{T(a & S::AllOnes)}, y{T(b & S::AllOnes)},
+            paddedX{T(a | Padding)}, paddedY{T(b | Padding)};
+        auto same = [](S clean, S padded) {
+            CHECK(clean.value() == padded.significantBits());
+        };
+        auto sum = fullAddition(x, y).result;
+        same(sum, fullAddition(paddedX, paddedY).result);
+        same(fullSubtraction(x, y).result, fullSubtraction(paddedX, paddedY).result);
+        auto ge = greaterEqual(x, y), eq = equals(x, y);
+        same(ge, greaterEqual(paddedX, paddedY));
+        same(eq, equals(paddedX, paddedY));
+        same(signedGreaterEqual(x, y), signedGreaterEqual(paddedX, paddedY));
+        auto max = maximum(x, y);
+        same(max, maximum(paddedX, paddedY));
+        auto average = roundingAverage(x, y);
+        same(average, roundingAverage(paddedX, paddedY));
+        same(absoluteDifference(x, y), absoluteDifference(paddedX, paddedY));
+        same(
+            saturatingSignedAddition(x, y),
+            saturatingSignedAddition(paddedX, paddedY)
+        );
+        same(
+            saturatingUnsignedSubtraction(x, y),
+            saturatingUnsignedSubtraction(paddedX, paddedY)
+        );
+        same(divideByConstant<4>(x), divideByConstant<4>(paddedX));
+        same(x.shiftLanesRight(1), paddedX.shiftLanesRight(1));
+        CHECK(x.shiftLanesLeft(1).value() == paddedX.shiftLanesLeft(1).value());
+        CHECK(x.lsbIndex() == paddedX.lsbIndex());
+        CHECK(x.top() == paddedX.top());
+        // the padding of the results of clean operands stays clear
+        CHECK(0 == (sum.value() & Padding));
+        CHECK(0 == (average.value() & Padding));
+        CHECK(0 == (broadcast(S{T(x.at(0))}).value() & Padding));
+        for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+            uint64_t l = x.at(lane), r = y.at(lane);
+            CHECK((l + r) % Modulo == sum.at(lane));
+            CHECK((r <= l) == (0 != ge.at(lane)));
+            CHECK((r == l) == (0 != eq.at(lane)));
+            CHECK((l < r ? r : l) == max.at(lane));
+            CHECK((l + r + 1) / 2 == average.at(lane));
+            CHECK(x.at(0) == broadcast(S{T(x.at(0))}).at(lane));
+        }
+    }
+}
+
+}
+
+TEST_CASE("Lanes of widths that do not divide the type", "[swar]") {
+    std::mt19937_64 g(47);
+    checkPaddingIsIgnored<SWAR<5, u64>>(g);
+    checkPaddingIsIgnored<SWAR<12, u64>>(g);
+    checkPaddingIsIgnored<SWAR<7, u64>>(g);
+    checkPaddingIsIgnored<SWAR<7, u32>>(g);
+    checkPaddingIsIgnored<SWAR<12, u32>>(g);
+    checkPaddingIsIgnored<SWAR<3, u16>>(g);
+    checkPaddingIsIgnored<SWAR<5, u16>>(g);
+    checkPaddingIsIgnored<SWAR<3, u8>>(g);
+}
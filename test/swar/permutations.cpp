@@ -0,0 +1,101 @@
+#include "zoo/swar/permutations.h"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+static_assert(0x01'02'03'04 == permuteLanes<3, 2, 1, 0>(SWAR<8, u32>{0x04'03'02'01}).value());
+static_assert(0x03'02'01'04 == permuteLanes<3, 0, 1, 2>(SWAR<8, u32>{0x04'03'02'01}).value());
+static_assert(0x01'01'04'04 == permuteLanes<3, 3, 0, 0>(SWAR<8, u32>{0x04'03'02'01}).value());
+static_assert(0x3'3'3'3 == broadcastLane(SWAR<4, u16>{0x4'3'2'1}, 2).value());
+static_assert(0x2222'2222'2222'2222 == broadcastLane(SWAR<16, u64>{0x1111'2222'3333'4444}, 2).value());
+static_assert(0x22'12'21'11 == zipLanes(SWAR<8, u32>{0x14'13'12'11}, SWAR<8, u32>{0x24'23'22'21}).low.value());
+static_assert(0x24'14'23'13 == zipLanes(SWAR<8, u32>{0x14'13'12'11}, SWAR<8, u32>{0x24'23'22'21}).high.value());
+static_assert(0x14'13'12'11 == unzipLanes(SWAR<8, u32>{0x22'12'21'11}, SWAR<8, u32>{0x24'14'23'13}).even.value());
+static_assert(0x24'23'22'21 == unzipLanes(SWAR<8, u32>{0x22'12'21'11}, SWAR<8, u32>{0x24'14'23'13}).odd.value());
+static_assert(0x8040'2010'0804'0201 == transposeBits8x8(0x8040'2010'0804'0201));
+static_assert(0xFF == transposeBits8x8(0x0101'0101'0101'0101));
+
+namespace {
+
+template<typename S, int... Indices>
+void checkPermutation(S input) {
+    constexpr int Sources[] = { Indices... };
+    auto permuted = permuteLanes<Indices...>(input);
+    for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+        CHECK(input.at(Sources[lane]) == permuted.at(lane));
+    }
+}
+
+template<typename S>
+void checkZip(S a, S b) {
+    constexpr auto Half = int(S::Lanes) / 2;
+    auto zipped = zipLanes(a, b);
+    for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+        auto &source = lane % 2 ? b : a;
+        CHECK(source.at(lane / 2) == zipped.low.at(lane));
+        CHECK(source.at(Half + lane / 2) == zipped.high.at(lane));
+    }
+    auto unzipped = unzipLanes(zipped.low, zipped.high);
+    CHECK(a.value() == unzipped.even.value());
+    CHECK(b.value() == unzipped.odd.value());
+}
+
+template<typename S>
+void checkLanes(std::mt19937_64 &g) {
+    using T = typename S::type;
+    for(auto count = 1000; count--; ) {
+        auto input = S{T(g())};
+        for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+            auto broadcasted = broadcastLane(input, lane);
+            for(auto other = 0; other < int(S::Lanes); ++other) {
+                CHECK(input.at(lane) == broadcasted.at(other));
+            }
+        }
+        checkZip(input, S{T(g())});
+    }
+}
+
+}
+
+TEST_CASE("Permutations of lanes", "[swar]") {
+    std::mt19937_64 g(46);
+    for(auto count = 1000; count--; ) {
+        auto v = g();
+        checkPermutation<SWAR<8, u64>, 7, 6, 5, 4, 3, 2, 1, 0>(SWAR<8, u64>{v});
+        checkPermutation<SWAR<8, u64>, 1, 2, 3, 4, 5, 6, 7, 0>(SWAR<8, u64>{v});
+        checkPermutation<SWAR<8, u64>, 0, 0, 7, 7, 2, 5, 4, 1>(SWAR<8, u64>{v});
+        checkPermutation<SWAR<16, u64>, 2, 0, 3, 1>(SWAR<16, u64>{v});
+        checkPermutation<SWAR<4, u16>, 1, 1, 1, 1>(SWAR<4, u16>{u16(v)});
+        checkPermutation<SWAR<7, u32>, 3, 0, 1, 2>(SWAR<7, u32>{u32(v)});
+        checkPermutation<SWAR<32, u64>, 1, 0>(SWAR<32, u64>{v});
+    }
+    checkLanes<SWAR<4, u64>>(g);
+    checkLanes<SWAR<8, u64>>(g);
+    checkLanes<SWAR<16, u64>>(g);
+    checkLanes<SWAR<32, u64>>(g);
+    checkLanes<SWAR<8, u32>>(g);
+    checkLanes<SWAR<4, u16>>(g);
+    checkLanes<SWAR<4, u8>>(g);
+}
+
+TEST_CASE("Transposes of 8x8 matrices", "[swar]") {
+    std::mt19937_64 g(46);
+    for(auto count = 1000; count--; ) {
+        std::array<uint64_t, 8> rows;
+        for(auto &row: rows) { row = g(); }
+        auto columns = transposeBytes8x8(rows);
+        auto bits = transposeBits8x8(rows[0]);
+        for(auto i = 0; i < 8; ++i) {
+            for(auto j = 0; j < 8; ++j) {
+                CHECK(((rows[i] >> (8 * j)) & 0xFF) == ((columns[j] >> (8 * i)) & 0xFF));
+                CHECK(((rows[0] >> (8 * i + j)) & 1) == ((bits >> (8 * j + i)) & 1));
+            }
+        }
+        CHECK(rows == transposeBytes8x8(columns));
+        CHECK(rows[0] == transposeBits8x8(bits));
+    }
+}
@@ -0,0 +1,73 @@
+#include "zoo/swar/ranges.h"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+namespace {
+
+constexpr std::byte operator""_b(char c) { return std::byte(c); }
+
+}
+
+TEST_CASE("Byte range algorithms", "[swar][ranges]") {
+    std::mt19937_64 g(38);
+    // Values in a small alphabet to have plenty of matches, a guard region
+    // around the ranges detects reads reported as matches and writes outside
+    std::vector<unsigned char> buffer(256 + 32);
+    for(auto &c: buffer) { c = 'a' + g() % 4; }
+    auto check = [&](std::size_t offset, std::size_t size) {
+        auto begin = buffer.data() + offset, end = begin + size;
+        ByteSpan range(begin, size);
+        auto b = 'b'_b;
+        CHECK(std::size_t(std::find(begin, end, 'b') - begin) == findByte(range, b));
+        CHECK(std::size_t(std::count(begin, end, 'b')) == countByte(range, b));
+        std::string set = "cd";
+        CHECK(
+            std::size_t(std::find_first_of(begin, end, set.begin(), set.end()) - begin) ==
+            findFirstOf(range, set)
+        );
+        auto isA = [](ByteLanes l) { return equals(l, ByteLanes{0x6161'6161'6161'6161}); };
+        CHECK(std::all_of(begin, end, [](char c) { return 'a' == c; }) == allOf(range, isA));
+        CHECK(std::any_of(begin, end, [](char c) { return 'a' == c; }) == anyOf(range, isA));
+
+        auto copy = buffer;
+        std::replace(copy.begin() + offset, copy.begin() + offset + size, 'c', 'z');
+        auto replaced = buffer;
+        replaceByte(MutableByteSpan(replaced.data() + offset, size), 'c'_b, 'z'_b);
+        CHECK(copy == replaced);
+
+        copy = buffer;
+        std::transform(
+            copy.begin() + offset, copy.begin() + offset + size,
+            copy.begin() + offset, [](unsigned char c) { return c - 0x20; }
+        );
+        auto transformed = buffer;
+        transformLanes(
+            MutableByteSpan(transformed.data() + offset, size),
+            [](ByteLanes l) { return l - ByteLanes{0x2020'2020'2020'2020}; }
+        );
+        CHECK(copy == transformed);
+    };
+    for(std::size_t offset = 8; offset < 24; ++offset) {
+        for(std::size_t size = 0; size < 40; ++size) { check(offset, size); }
+        check(offset, 256);
+    }
+    SECTION("No matches in the bytes outside of the range") {
+        std::vector<char> bs(64, 'x');
+        bs[10] = bs[30] = 'y';
+        CHECK(19 == findByte(ByteSpan(bs.data() + 11, 20), 'y'_b));
+        // not found is the size
+        CHECK(19 == findByte(ByteSpan(bs.data() + 11, 19), 'y'_b));
+        CHECK(0 == countByte(ByteSpan(bs.data() + 11, 19), 'y'_b));
+        CHECK(allOf(ByteSpan(bs.data() + 11, 19), [](ByteLanes l) {
+            return equals(l, ByteLanes{0x7878'7878'7878'7878});
+        }));
+    }
+}
@@ -0,0 +1,74 @@
+#include "zoo/swar/reductions.h"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+static_assert(0x1C'15'0F'0A'06'03'01'00 == prefixSumLanes(SWAR<8, u64>{0x07'06'05'04'03'02'01'00}).value());
+static_assert(0x15'0F'0A'06'03'01'00'00 == exclusivePrefixSumLanes(SWAR<8, u64>{0x07'06'05'04'03'02'01'00}).value());
+// wraps around in each lane
+static_assert(0x00'FF == prefixSumLanes(SWAR<8, u16>{0x01'FF}).value());
+static_assert(0x1C'15'0F'0A'06'03'01'00 == prefixSumLanes_OverflowUnsafe(SWAR<8, u64>{0x07'06'05'04'03'02'01'00}).value());
+static_assert(8 * 255 == horizontalSum(SWAR<8, u64>{~u64(0)}));
+static_assert(16 * 15 == horizontalSum(SWAR<4, u64>{~u64(0)}));
+static_assert(2 * 0xFFFF'FFFFull == horizontalSum(SWAR<32, u64>{~u64(0)}));
+static_assert(0xF7 == horizontalMax(SWAR<8, u64>{0x01'80'F7'00'33'44'55'66}));
+static_assert(0x00 == horizontalMin(SWAR<8, u64>{0x01'80'F7'00'33'44'55'66}));
+static_assert(0x01 == horizontalMin(SWAR<8, u64>{0x01'80'F7'FF'33'44'55'66}));
+// 5 lanes of 3 bits and a padding bit set, that must be ignored
+static_assert(7 == horizontalMax(SWAR<3, u16>{0b1'000'111'001'010'011}));
+static_assert(0 == horizontalMin(SWAR<3, u16>{0b1'000'111'001'010'011}));
+static_assert(13 == horizontalSum(SWAR<3, u16>{0b1'000'111'001'010'011}));
+
+namespace {
+
+template<typename S>
+void checkReductions(std::mt19937_64 &g) {
+    using T = typename S::type;
+    for(auto count = 1000; count--; ) {
+        S input{T(g())};
+        // a third of the inputs with small values, not to always overflow
+        if(0 == count % 3) { input = input & S{S::LeastSignificantBit}; }
+        T sum = 0, max = 0, min = S::MaxUnsignedLaneValue;
+        T prefix[S::Lanes], exclusive[S::Lanes];
+        for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+            T v = input.at(lane);
+            exclusive[lane] = sum & S::MaxUnsignedLaneValue;
+            sum += v;
+            prefix[lane] = sum & S::MaxUnsignedLaneValue;
+            if(max < v) { max = v; }
+            if(v < min) { min = v; }
+        }
+        CHECK(sum == horizontalSum(input));
+        CHECK(max == horizontalMax(input));
+        CHECK(min == horizontalMin(input));
+        auto prefixSums = prefixSumLanes(input);
+        auto exclusiveSums = exclusivePrefixSumLanes(input);
+        for(auto lane = 0; lane < int(S::Lanes); ++lane) {
+            CHECK(prefix[lane] == prefixSums.at(lane));
+            CHECK(exclusive[lane] == exclusiveSums.at(lane));
+        }
+    }
+}
+
+}
+
+TEST_CASE("Horizontal reductions and prefix sums", "[swar]") {
+    std::mt19937_64 g(39);
+    checkReductions<SWAR<2, u64>>(g);
+    checkReductions<SWAR<4, u64>>(g);
+    checkReductions<SWAR<8, u64>>(g);
+    checkReductions<SWAR<16, u64>>(g);
+    checkReductions<SWAR<32, u64>>(g);
+    checkReductions<SWAR<64, u64>>(g);
+    checkReductions<SWAR<4, u32>>(g);
+    checkReductions<SWAR<8, u32>>(g);
+    checkReductions<SWAR<4, u16>>(g);
+    checkReductions<SWAR<4, u8>>(g);
+    checkReductions<SWAR<3, u16>>(g);
+    checkReductions<SWAR<5, u64>>(g);
+    checkReductions<SWAR<7, u32>>(g);
+}
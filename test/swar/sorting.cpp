@@ -0,0 +1,96 @@
+#include "zoo/swar/sorting.h"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+static_assert(0x08'07'06'05'04'03'02'01 == sortLanes(SWAR<8, u64>{0x03'01'08'02'07'05'04'06}).value());
+static_assert(0xFF'80'80'00 == sortLanes(SWAR<8, u32>{0x80'00'FF'80}).value());
+static_assert(0xF'7'3'1 == sortLanes(SWAR<4, u16>{0x3'F'1'7}).value());
+// 5 lanes of 3 bits and a padding bit that is cleared
+static_assert(0b0'111'101'011'001'000 == sortLanes(SWAR<3, u16>{0b1'001'111'000'101'011}).value());
+static_assert(0x1'2'3'4 == reverseLanes(SWAR<4, u16>{0x4'3'2'1}).value());
+static_assert(0x0F'01 == minMax(SWAR<8, u16>{0x0F'FF}, SWAR<8, u16>{0x10'01}).lesser.value());
+static_assert(0x10'FF == minMax(SWAR<8, u16>{0x0F'FF}, SWAR<8, u16>{0x10'01}).greater.value());
+constexpr auto Merged =
+    mergeSortedLanes(SWAR<8, u32>{0x08'06'03'01}, SWAR<8, u32>{0x09'07'04'02});
+static_assert(0x04'03'02'01 == Merged.lesser.value());
+static_assert(0x09'08'07'06 == Merged.greater.value());
+
+namespace {
+
+template<typename S>
+std::vector<typename S::type> lanes(S s) {
+    std::vector<typename S::type> rv;
+    for(auto lane = 0; lane < int(S::Lanes); ++lane) { rv.push_back(s.at(lane)); }
+    return rv;
+}
+
+template<typename S>
+void checkSort(S input) {
+    auto expected = lanes(input);
+    std::sort(expected.begin(), expected.end());
+    CHECK(expected == lanes(sortLanes(input)));
+}
+
+template<typename S>
+void checkSorting(std::mt19937_64 &g) {
+    using T = typename S::type;
+    for(auto count = 5000; count--; ) {
+        auto r = g();
+        // one in two with few distinct values, to have repetitions
+        if(count & 1) { r &= S::LeastSignificantBit * 3; }
+        checkSort(S{T(r)});
+    }
+}
+
+template<typename S>
+void checkMerge(std::mt19937_64 &g) {
+    using T = typename S::type;
+    for(auto count = 5000; count--; ) {
+        auto
+            a = sortLanes(S{T(g())}),
+            b = sortLanes(S{T(count & 1 ? g() & (S::LeastSignificantBit * 3) : g())});
+        auto merged = mergeSortedLanes(a, b);
+        auto expected = lanes(a), fromB = lanes(b);
+        expected.insert(expected.end(), fromB.begin(), fromB.end());
+        std::sort(expected.begin(), expected.end());
+        auto result = lanes(merged.lesser), greater = lanes(merged.greater);
+        result.insert(result.end(), greater.begin(), greater.end());
+        CHECK(expected == result);
+    }
+}
+
+}
+
+TEST_CASE("Sorting networks of lanes", "[swar]") {
+    // all the values of 4 lanes of 4 bits
+    for(uint32_t v = 0; v < (1 << 16); ++v) { checkSort(SWAR<4, u16>{u16(v)}); }
+    std::mt19937_64 g(45);
+    checkSorting<SWAR<8, u64>>(g);
+    checkSorting<SWAR<16, u64>>(g);
+    checkSorting<SWAR<32, u64>>(g);
+    checkSorting<SWAR<8, u32>>(g);
+    checkSorting<SWAR<4, u64>>(g);
+    checkSorting<SWAR<2, u64>>(g);
+    checkSorting<SWAR<3, u16>>(g);
+    checkSorting<SWAR<5, u64>>(g);
+    checkSorting<SWAR<7, u32>>(g);
+    checkSorting<SWAR<64, u64>>(g);
+}
+
+TEST_CASE("Merge of sorted lanes", "[swar]") {
+    std::mt19937_64 g(45);
+    checkMerge<SWAR<8, u64>>(g);
+    checkMerge<SWAR<16, u64>>(g);
+    checkMerge<SWAR<32, u64>>(g);
+    checkMerge<SWAR<64, u64>>(g);
+    checkMerge<SWAR<4, u64>>(g);
+    checkMerge<SWAR<8, u32>>(g);
+    checkMerge<SWAR<8, u16>>(g);
+}
@@ -0,0 +1,133 @@
+#include "zoo/swar/utf8.h"
+
+#include "catch2/catch.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace zoo;
+using namespace zoo::swar;
+
+namespace {
+
+/// Decoder of one code point at a time, RFC 3629
+bool scalarValidate(const unsigned char *p, std::size_t size) {
+    auto end = p + size;
+    while(p < end) {
+        unsigned c = *p++;
+        int length;
+        unsigned minimum, codePoint;
+        if(c < 0x80) { continue; }
+        else if(0xC0 == (c & 0xE0)) { length = 1; minimum = 0x80; codePoint = c & 0x1F; }
+        else if(0xE0 == (c & 0xF0)) { length = 2; minimum = 0x800; codePoint = c & 0x0F; }
+        else if(0xF0 == (c & 0xF8)) { length = 3; minimum = 0x10000; codePoint = c & 0x07; }
+        else { return false; }
+        if(end - p < length) { return false; }
+        while(length--) {
+            unsigned next = *p++;
+            if(0x80 != (next & 0xC0)) { return false; }
+            codePoint = (codePoint << 6) | (next & 0x3F);
+        }
+        if(codePoint < minimum || 0x10FFFF < codePoint) { return false; }
+        if(0xD800 <= codePoint && codePoint <= 0xDFFF) { return false; }
+    }
+    return true;
+}
+
+void append(std::string &s, unsigned codePoint) {
+    if(codePoint < 0x80) { s += char(codePoint); }
+    else if(codePoint < 0x800) {
+        s += char(0xC0 | (codePoint >> 6));
+        s += char(0x80 | (codePoint & 0x3F));
+    } else if(codePoint < 0x10000) {
+        s += char(0xE0 | (codePoint >> 12));
+        s += char(0x80 | ((codePoint >> 6) & 0x3F));
+        s += char(0x80 | (codePoint & 0x3F));
+    } else {
+        s += char(0xF0 | (codePoint >> 18));
+        s += char(0x80 | ((codePoint >> 12) & 0x3F));
+        s += char(0x80 | ((codePoint >> 6) & 0x3F));
+        s += char(0x80 | (codePoint & 0x3F));
+    }
+}
+
+/// Code points of all the lengths, with the extremes of each length
+unsigned randomCodePoint(std::mt19937_64 &g) {
+    static const unsigned Extremes[] = {
+        0, 0x7F, 0x80, 0x7FF, 0x800, 0xD7FF, 0xE000, 0xFFFF, 0x10000, 0x10FFFF
+    };
+    auto r = g();
+    switch(r % 5) {
+        case 0: return Extremes[(r >> 8) % 10];
+        case 1: return (r >> 8) % 0x80;
+        case 2: return 0x80 + (r >> 8) % 0x780;
+        case 3: {
+            auto c = 0x800 + unsigned((r >> 8) % 0xF800);
+            return 0xD800 <= c && c <= 0xDFFF ? c - 0x800 : c;
+        }
+        default: return 0x10000 + (r >> 8) % 0x100000;
+    }
+}
+
+void checkAllOffsets(const std::string &text, bool isValid) {
+    // the alignments of the text with respect to the blocks
+    std::vector<char> buffer(text.size() + 16);
+    for(auto offset = 0; offset < 8; ++offset) {
+        std::copy(text.begin(), text.end(), buffer.begin() + offset);
+        ByteSpan range(buffer.data() + offset, text.size());
+        CHECK(isValid == validateUTF8(range));
+    }
+}
+
+}
+
+TEST_CASE("UTF-8 validation and count of code points", "[swar][ranges]") {
+    auto valid = [](std::string text) { return validateUTF8(text); };
+    CHECK(valid("ASCII text only"));
+    CHECK(valid("\xC3\xB1" "and\xE2\x82\xAC" "\xF0\x9F\x98\x80"));
+    std::string mixed = "\xC3\xB1" "and\xE2\x82\xAC";
+    CHECK(5 == countCodePoints(mixed));
+    CHECK(!valid("\xC0\x80")); // overlong 0
+    CHECK(!valid("\xE0\x9F\xBF")); // overlong U+07FF
+    CHECK(!valid("\xED\xA0\x80")); // surrogate
+    CHECK(!valid("\xF4\x90\x80\x80")); // U+110000
+    CHECK(!valid("0123456\xE2\x82")); // truncated at the end of a block
+    CHECK(!valid("\x80")); // lone continuation
+
+    std::mt19937_64 g(49);
+    SECTION("All the sequences of up to 3 bytes") {
+        std::string s(3, '\0');
+        for(unsigned v = 0; v < (1 << 24); v += 1 + g() % 64) {
+            s[0] = char(v >> 16); s[1] = char(v >> 8); s[2] = char(v);
+            auto isValid = scalarValidate(reinterpret_cast<const unsigned char *>(s.data()), 3);
+            CHECK(isValid == validateUTF8(s));
+        }
+        for(unsigned v = 0; v < (1 << 16); ++v) {
+            s.resize(2);
+            s[0] = char(v >> 8); s[1] = char(v);
+            auto isValid = scalarValidate(reinterpret_cast<const unsigned char *>(s.data()), 2);
+            CHECK(isValid == validateUTF8(s));
+            s.resize(3);
+        }
+    }
+    SECTION("Random texts and their corruptions") {
+        for(auto count = 1000; count--; ) {
+            std::string text;
+            std::size_t codePoints = 0;
+            for(auto length = g() % 64; length--; ++codePoints) {
+                append(text, randomCodePoint(g));
+            }
+            checkAllOffsets(text, true);
+            CHECK(codePoints == countCodePoints(text));
+            if(text.empty()) { continue; }
+            auto corrupted = text;
+            corrupted[g() % text.size()] = char(g());
+            auto data = reinterpret_cast<const unsigned char *>(corrupted.data());
+            checkAllOffsets(corrupted, scalarValidate(data, corrupted.size()));
+            auto truncated = text.substr(0, g() % text.size());
+            data = reinterpret_cast<const unsigned char *>(truncated.data());
+            checkAllOffsets(truncated, scalarValidate(data, truncated.size()));
+        }
+    }
+}